@@ -0,0 +1,31 @@
+#include "UnrealEngineLSP.hpp"
+#include <new>
+
+// =============================================================================
+// 할당 횟수 계측 (요청당 할당 수 통계용)
+// 전역 operator new 교체는 링크한 바이너리 전체에 적용되므로 코어 라이브러리가 아닌
+// 서버와 벤치마크 실행 파일에만 포함
+// =============================================================================
+
+// 나머지 operator new/delete 변형은 표준 기본 구현이 이 두 함수로 위임
+// (GCC는 인라인된 교체 delete의 free를 new와 짝이 안 맞는다고 오탐)
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void* operator new(std::size_t size) {
+    UnrealEngine::ServerMetrics::countAllocation();
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,306 @@
+#include "BenchmarkCorpus.hpp"
+#include <sys/resource.h>
+
+namespace UnrealEngine {
+namespace Benchmark {
+
+namespace {
+
+const std::vector<std::string> kVerbs = {
+    "Get", "Set", "Update", "Compute", "Find", "Apply", "Reset", "Handle", "Spawn", "Notify"
+};
+
+const std::vector<std::string> kNouns = {
+    "Location", "Rotation", "Health", "Velocity", "Component", "Target", "Owner", "State",
+    "Transform", "Damage", "Ability", "Inventory"
+};
+
+const std::vector<std::string> kTypes = {
+    "void", "float", "int32", "bool", "FVector", "FRotator", "FString", "AActor*", "UActorComponent*"
+};
+
+std::string pick(const std::vector<std::string>& values, std::mt19937& random) {
+    return values[random() % values.size()];
+}
+
+void writeFile(const fs::path& path, const std::string& content) {
+    fs::create_directories(path.parent_path());
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << content;
+}
+
+std::string frame(const json& message) {
+    std::string payload = message.dump();
+    return "Content-Length: " + std::to_string(payload.size()) + "\r\n\r\n" + payload;
+}
+
+} // namespace
+
+std::string generateHeader(const std::string& apiMacro, const std::string& baseName,
+                           const CorpusOptions& options, std::mt19937& random,
+                           std::vector<std::string>* classNames) {
+    std::ostringstream ss;
+
+    ss << "// Copyright Epic Games, Inc. All Rights Reserved.\n\n";
+    ss << "#pragma once\n\n";
+    ss << "#include \"CoreMinimal.h\"\n";
+    ss << "#include \"UObject/ObjectMacros.h\"\n";
+    ss << "#include \"" << baseName << ".generated.h\"\n\n";
+
+    for (size_t c = 0; c < options.classesPerHeader; ++c) {
+        std::string className = "A" + baseName + (c ? std::to_string(c) : "");
+        if (classNames) classNames->push_back(className);
+
+        ss << "/**\n * Generated benchmark class " << className << "\n */\n";
+        ss << "UCLASS(BlueprintType, Blueprintable)\n";
+        ss << "class " << apiMacro << " " << className << " : public AActor\n{\n";
+        ss << "\tGENERATED_BODY()\n\npublic:\n";
+        ss << "\t" << className << "();\n\n";
+        ss << "\tvirtual void BeginPlay() override;\n";
+        ss << "\tvirtual void Tick(float DeltaTime) override;\n\n";
+
+        for (size_t m = 0; m < options.methodsPerClass; ++m) {
+            std::string name = pick(kVerbs, random) + pick(kNouns, random) + std::to_string(m);
+            std::string type = pick(kTypes, random);
+
+            if (m % 3 == 0) {
+                ss << "\tUFUNCTION(BlueprintCallable, Category = \"Benchmark\")\n";
+            }
+            ss << "\t" << (m % 5 == 0 ? "virtual " : "") << type << " " << name
+               << "(int32 Index, const FVector& Direction)" << (m % 2 ? " const" : "") << ";\n";
+
+            if (m % 4 == 0) {
+                ss << "\n\tUPROPERTY(EditAnywhere, BlueprintReadWrite" << (m % 8 == 0 ? ", Replicated" : "")
+                   << ", Category = \"Benchmark\")\n";
+                ss << "\tfloat " << pick(kNouns, random) << "Value" << m << " = 0.0f;\n\n";
+            }
+        }
+
+        ss << "\nprivate:\n";
+        ss << "\tvoid InternalHelper() { /* inline body */ }\n";
+        ss << "};\n\n";
+    }
+
+    return ss.str();
+}
+
+std::string generateLog(size_t lines, std::mt19937& random) {
+    std::ostringstream ss;
+
+    for (size_t i = 0; i < lines; ++i) {
+        ss << "[2024.05.01-12.00." << (i % 60) << ":" << (i % 1000) << "][" << (i % 500) << "]";
+
+        switch (random() % 10) {
+            case 0: ss << "LogStats: " << pick(kNouns, random) << "Update took " << (random() % 400) / 10.0 << "ms"; break;
+            case 1: ss << "LogGC: Garbage collection took " << (random() % 200) / 10.0 << "ms"; break;
+            case 2: ss << "LogTemp: Warning: " << pick(kNouns, random) << " is not valid"; break;
+            case 3: ss << "LogBlueprint: Error: Accessed None trying to read " << pick(kNouns, random); break;
+            case 4: ss << "LogMemory: " << (random() % 4096) << " bytes leaked"; break;
+            default: ss << "LogNet: Connection " << (random() % 32) << " heartbeat ok"; break;
+        }
+        ss << "\n";
+    }
+
+    return ss.str();
+}
+
+std::vector<std::string> generateCompileErrors(size_t count, std::mt19937& random) {
+    std::vector<std::string> errors;
+    errors.reserve(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        std::string file = "/Project/Source/Bench/Bench" + std::to_string(i % 37) + ".cpp(" + std::to_string(10 + i % 400) + "): ";
+        switch (random() % 6) {
+            case 0: errors.push_back(file + "error: use of undeclared identifier '" + pick(kNouns, random) + "'"); break;
+            case 1: errors.push_back(file + "error: no member named '" + pick(kVerbs, random) + pick(kNouns, random) + "' in 'AActor'"); break;
+            case 2: errors.push_back(file + "error: UCLASS() must be the first thing in the class declaration"); break;
+            case 3: errors.push_back(file + "error: GENERATED_BODY() not found"); break;
+            case 4: errors.push_back(file + "error: Cannot find definition for module '" + pick(kNouns, random) + "Module'"); break;
+            default: errors.push_back(file + "error: expected ';' after expression"); break;
+        }
+    }
+
+    return errors;
+}
+
+GeneratedCorpus generateCorpus(const std::string& root, const CorpusOptions& options) {
+    std::mt19937 random(options.seed);
+    GeneratedCorpus corpus;
+
+    corpus.enginePath = (fs::path(root) / "UE_5.3").string();
+    corpus.projectPath = (fs::path(root) / "BenchProject").string();
+
+    writeFile(fs::path(corpus.enginePath) / "Engine/Build/Build.version",
+              "{\"MajorVersion\": 5, \"MinorVersion\": 3, \"PatchVersion\": 2}\n");
+
+    // VersionSpecificAPI::getIncludePaths 가 스캔하는 경로에 고르게 분산
+    const std::vector<std::string> moduleDirs = {
+        "Engine/Source/Runtime/Core/Public",
+        "Engine/Source/Runtime/CoreUObject/Public",
+        "Engine/Source/Runtime/Engine/Public",
+        "Engine/Source/Runtime/Engine/Classes/GameFramework",
+        "Engine/Source/Runtime/UMG/Public/Components"
+    };
+
+    for (size_t module = 0; module < options.modules; ++module) {
+        const std::string& dir = moduleDirs[module % moduleDirs.size()];
+        for (size_t h = 0; h < options.headersPerModule; ++h) {
+            std::string baseName = "Bench" + std::to_string(module) + "Type" + std::to_string(h);
+            writeFile(fs::path(corpus.enginePath) / dir / (baseName + ".h"),
+                      generateHeader("ENGINE_API", baseName, options, random, &corpus.classNames));
+        }
+    }
+
+    // 플러그인은 별도 난수열 - 기존 엔진/프로젝트 내용은 그대로 유지
+    std::mt19937 pluginRandom(options.seed + 1);
+    auto writePlugin = [&](const fs::path& pluginRoot, const std::string& name, const std::string& apiMacro) {
+        writeFile(pluginRoot / (name + ".uplugin"),
+                  "{\"FileVersion\": 3, \"Version\": 1, \"VersionName\": \"1.0\", \"FriendlyName\": \"" + name + "\"}\n");
+        for (size_t h = 0; h < options.headersPerPlugin; ++h) {
+            std::string baseName = name + "Type" + std::to_string(h);
+            writeFile(pluginRoot / "Source" / name / "Public" / (baseName + ".h"),
+                      generateHeader(apiMacro, baseName, options, pluginRandom));
+        }
+    };
+    
+    json projectPlugins = json::array();
+    for (size_t p = 0; p < options.enginePlugins; ++p) {
+        std::string name = "BenchPlugin" + std::to_string(p);
+        writePlugin(fs::path(corpus.enginePath) / "Engine/Plugins/Runtime" / name, name, "BENCHPLUGIN" + std::to_string(p) + "_API");
+        if (p < options.enabledPlugins) {
+            projectPlugins.push_back({{"Name", name}, {"Enabled", true}});
+        }
+    }
+    writePlugin(fs::path(corpus.projectPath) / "Plugins/BenchProjectPlugin", "BenchProjectPlugin", "BENCHPROJECTPLUGIN_API");
+    
+    json project = {
+        {"FileVersion", 3},
+        {"EngineAssociation", "5.3"},
+        {"Modules", json::array({{{"Name", "BenchProject"}, {"Type", "Runtime"}}})},
+        {"Plugins", projectPlugins}
+    };
+    writeFile(fs::path(corpus.projectPath) / "BenchProject.uproject", project.dump() + "\n");
+
+    for (size_t h = 0; h < options.projectHeaders; ++h) {
+        std::string baseName = "Game" + std::to_string(h);
+        fs::path header = fs::path(corpus.projectPath) / "Source/BenchProject/Public" / (baseName + ".h");
+        writeFile(header, generateHeader("BENCHPROJECT_API", baseName, options, random));
+        writeFile(fs::path(corpus.projectPath) / "Source/BenchProject/Private" / (baseName + ".cpp"),
+                  "#include \"" + baseName + ".h\"\n#include \"GameFramework/Actor.h\"\n\nvoid A" + baseName +
+                  "::BeginPlay()\n{\n\tSuper::BeginPlay();\n}\n");
+        corpus.projectHeaders.push_back(header.string());
+    }
+
+    writeFile(fs::path(corpus.projectPath) / "Saved/Logs/BenchProject.log", generateLog(options.logLines, random));
+
+    std::string buildLog;
+    for (const auto& error : generateCompileErrors(options.compileErrors, random)) {
+        buildLog += error + "\n";
+    }
+    writeFile(fs::path(corpus.projectPath) / "Saved/Logs/UnrealBuildTool.log", buildLog);
+
+    for (const auto& className : corpus.classNames) {
+        corpus.methodNames.push_back(className);
+    }
+    std::mt19937 nameRandom(options.seed);
+    for (size_t i = 0; i < 64; ++i) {
+        corpus.methodNames.push_back(pick(kVerbs, nameRandom) + pick(kNouns, nameRandom));
+    }
+
+    return corpus;
+}
+
+std::string generateSession(const GeneratedCorpus& corpus, size_t requests, uint32_t seed) {
+    std::mt19937 random(seed);
+    std::string session;
+    int id = 1;
+
+    session += frame({{"jsonrpc", "2.0"}, {"id", id++}, {"method", "initialize"}, {"params", {
+        {"rootUri", "file://" + corpus.projectPath}
+    }}});
+
+    for (size_t r = 0; r < requests; ++r) {
+        const std::string& header = corpus.projectHeaders[random() % corpus.projectHeaders.size()];
+        std::string uri = "file://" + header;
+
+        std::ifstream file(header);
+        std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        session += frame({{"jsonrpc", "2.0"}, {"method", "textDocument/didOpen"}, {"params", {
+            {"textDocument", {{"uri", uri}, {"languageId", "cpp"}, {"version", 1}, {"text", text}}}
+        }}});
+
+        // 타이핑 버스트 - 한 글자씩 증분 변경
+        int line = 10 + static_cast<int>(random() % 20);
+        const std::string typed = "GetActorLoc";
+        for (size_t c = 0; c < typed.size(); ++c) {
+            session += frame({{"jsonrpc", "2.0"}, {"method", "textDocument/didChange"}, {"params", {
+                {"textDocument", {{"uri", uri}, {"version", static_cast<int>(c) + 2}}},
+                {"contentChanges", json::array({{
+                    {"range", {{"start", {{"line", line}, {"character", static_cast<int>(c)}}},
+                               {"end", {{"line", line}, {"character", static_cast<int>(c)}}}}},
+                    {"text", std::string(1, typed[c])}
+                }})}
+            }}});
+        }
+
+        session += frame({{"jsonrpc", "2.0"}, {"id", id++}, {"method", "textDocument/completion"}, {"params", {
+            {"textDocument", {{"uri", uri}}},
+            {"position", {{"line", line}, {"character", static_cast<int>(typed.size())}}}
+        }}});
+
+        const std::string& name = corpus.methodNames[random() % corpus.methodNames.size()];
+        session += frame({{"jsonrpc", "2.0"}, {"id", id++}, {"method", "workspace/symbol"}, {"params", {
+            {"query", name.substr(0, 3 + random() % 4)}
+        }}});
+
+        if (r % 10 == 0) {
+            session += frame({{"jsonrpc", "2.0"}, {"id", id++}, {"method", "workspace/executeCommand"}, {"params", {
+                {"command", r % 20 == 0 ? "unreal.analyzeLogs" : "unreal.interpretErrors"},
+                {"arguments", json::array({{{"textDocument", {{"uri", uri}}}, {"position", {{"line", 0}, {"character", 0}}}}})}
+            }}});
+        }
+
+        session += frame({{"jsonrpc", "2.0"}, {"method", "textDocument/didClose"}, {"params", {
+            {"textDocument", {{"uri", uri}}}
+        }}});
+    }
+
+    session += frame({{"jsonrpc", "2.0"}, {"id", id++}, {"method", "shutdown"}});
+    return session;
+}
+
+std::vector<std::string> splitFramedMessages(const std::string& session) {
+    std::vector<std::string> messages;
+    size_t pos = 0;
+
+    while (pos < session.size()) {
+        size_t header = session.find("Content-Length:", pos);
+        if (header == std::string::npos) break;
+
+        size_t headerEnd = session.find("\r\n\r\n", header);
+        if (headerEnd == std::string::npos) break;
+
+        size_t length = std::stoul(session.substr(header + 15, headerEnd - header - 15));
+        size_t body = headerEnd + 4;
+        if (body + length > session.size()) break;
+
+        messages.push_back(session.substr(body, length));
+        pos = body + length;
+    }
+
+    return messages;
+}
+
+size_t peakResidentBytes() {
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+}
+
+} // namespace Benchmark
+} // namespace UnrealEngine
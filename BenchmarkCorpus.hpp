@@ -0,0 +1,69 @@
+#pragma once
+
+#include "UnrealEngineLSP.hpp"
+#include <random>
+
+namespace UnrealEngine {
+namespace Benchmark {
+
+// =============================================================================
+// 합성 UE 코퍼스 생성기 (벤치마크를 엔진 설치 없이 오프라인으로 실행)
+// =============================================================================
+
+struct CorpusOptions {
+    size_t modules = 4;
+    size_t headersPerModule = 40;
+    size_t classesPerHeader = 2;
+    size_t methodsPerClass = 24;
+    size_t projectHeaders = 30;
+    size_t logLines = 20000;
+    size_t compileErrors = 500;
+    size_t enginePlugins = 6;           // 그 중 enabledPlugins 개만 .uproject에서 켬
+    size_t enabledPlugins = 2;
+    size_t headersPerPlugin = 8;
+    uint32_t seed = 1234;
+};
+
+struct GeneratedCorpus {
+    std::string enginePath;
+    std::string projectPath;
+    std::vector<std::string> classNames;
+    std::vector<std::string> methodNames;
+    std::vector<std::string> projectHeaders;
+};
+
+// 결정적 입력 - 같은 seed면 항상 같은 내용
+std::string generateHeader(const std::string& apiMacro, const std::string& baseName,
+                           const CorpusOptions& options, std::mt19937& random,
+                           std::vector<std::string>* classNames = nullptr);
+std::string generateLog(size_t lines, std::mt19937& random);
+std::vector<std::string> generateCompileErrors(size_t count, std::mt19937& random);
+
+GeneratedCorpus generateCorpus(const std::string& root, const CorpusOptions& options);
+
+// 녹화된 세션과 같은 Content-Length 프레임 형식의 합성 세션
+std::string generateSession(const GeneratedCorpus& corpus, size_t requests, uint32_t seed);
+std::vector<std::string> splitFramedMessages(const std::string& session);
+
+size_t peakResidentBytes();
+
+// 비공개 커널을 격리해서 측정하기 위한 접근자 (분석기 클래스들이 friend로 선언)
+struct KernelAccess {
+    static void scanHeaderFile(DynamicHeaderScanner& scanner, const std::string& filePath) {
+        scanner.scanHeaderFile(filePath);
+    }
+    static std::vector<FunctionInfo> extractClassMethods(DynamicHeaderScanner& scanner,
+                                                         const std::string& content,
+                                                         const std::string& className) {
+        return scanner.extractClassMethods(content, className);
+    }
+    static std::vector<LogIssue> analyzeLogFile(UnrealLogAnalyzer& analyzer, const std::string& logFile) {
+        return analyzer.analyzeLogFile(logFile);
+    }
+    static CompileError interpretError(CompileErrorInterpreter& interpreter, const std::string& message) {
+        return interpreter.interpretError(message);
+    }
+};
+
+} // namespace Benchmark
+} // namespace UnrealEngine
@@ -25,7 +25,7 @@ echo -e "${YELLOW}🔨 Compiling directly with clang++...${NC}"
 
 clang++ -std=c++20 -O3 -Wall -Wextra -stdlib=libc++ \
     -I. \
-    main.cpp UnrealEngineLSP.cpp \
+    main.cpp UnrealEngineLSP.cpp AllocationCounting.cpp \
     -o unreal-lsp-server \
     -pthread
 
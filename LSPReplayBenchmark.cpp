@@ -0,0 +1,309 @@
+#include "UnrealEngineLSP.hpp"
+#include "BenchmarkCorpus.hpp"
+#include <map>
+#include <charconv>
+#include <cstdlib>
+
+using namespace UnrealEngine;
+
+// =============================================================================
+// LSP 세션 재생 벤치마크
+// 녹화된 세션(Content-Length 프레임)을 stdio 없이 LSPServer::run 으로 재생 (프레임 읽기 포함)
+// =============================================================================
+
+namespace {
+
+struct ReplayOptions {
+    std::vector<std::string> sessionFiles;
+    std::string corpusDir;
+    std::string baselinePath;
+    std::string writeBaselinePath;
+    std::string outputPath;
+    size_t iterations = 3;
+    size_t requests = 200;
+    double tolerance = 0.25;
+    Benchmark::CorpusOptions corpus;
+};
+
+void printUsage(const char* programName) {
+    std::cerr << "Usage: " << programName << " [options]\n";
+    std::cerr << "\nOptions:\n";
+    std::cerr << "  --session <file>         Replay a recorded session (repeatable, default: synthetic session)\n";
+    std::cerr << "  --corpus-dir <path>      Where to generate the synthetic engine/project corpus\n";
+    std::cerr << "  --headers <n>            Engine headers per module (default: 40)\n";
+    std::cerr << "  --methods <n>            Methods per generated class (default: 24)\n";
+    std::cerr << "  --log-lines <n>          Lines in the generated project log (default: 20000)\n";
+    std::cerr << "  --requests <n>           Edit/complete cycles in the synthetic session (default: 200)\n";
+    std::cerr << "  --iterations <n>         Times to replay each session (default: 3)\n";
+    std::cerr << "  --baseline <json>        Compare against a previous report, exit 1 on regression\n";
+    std::cerr << "  --tolerance <ratio>      Allowed slowdown before a metric counts as regressed (default: 0.25)\n";
+    std::cerr << "  --write-baseline <json>  Save this run as the new baseline\n";
+    std::cerr << "  --output <json>          Write the report to a file as well as stdout\n";
+}
+
+// 양의 정수 옵션 값 - 숫자가 아니거나 0 이하면 nullopt (main.cpp 와 같음)
+template <typename T>
+std::optional<T> parsePositive(const std::string& text) {
+    T value{};
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc() || end != text.data() + text.size() || value <= 0) return std::nullopt;
+    return value;
+}
+
+// 0 이상의 비율 - libc++ 는 부동소수점 from_chars 가 없어서 strtod 로 전체를 읽었는지 확인
+std::optional<double> parseRatio(const std::string& text) {
+    if (text.empty()) return std::nullopt;
+    char* end = nullptr;
+    double value = std::strtod(text.c_str(), &end);
+    if (end != text.c_str() + text.size() || !(value >= 0.0)) return std::nullopt;
+    return value;
+}
+
+double percentile(std::vector<double>& samples, double p) {
+    if (samples.empty()) return 0.0;
+    size_t index = static_cast<size_t>(p * static_cast<double>(samples.size() - 1) + 0.5);
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return samples[index];
+}
+
+json summarize(std::vector<double> samples) {
+    double total = 0.0;
+    for (double sample : samples) total += sample;
+
+    return {
+        {"count", samples.size()},
+        {"meanUs", samples.empty() ? 0.0 : total / static_cast<double>(samples.size())},
+        {"p50Us", percentile(samples, 0.50)},
+        {"p99Us", percentile(samples, 0.99)}
+    };
+}
+
+// 기준 대비 허용치를 넘게 느려진 지표 목록
+std::vector<std::string> findRegressions(const json& baseline, const json& current, double tolerance) {
+    std::vector<std::string> regressions;
+    constexpr double NoiseFloorUs = 50.0;   // 아주 짧은 요청의 지터는 무시
+
+    auto check = [&](const std::string& name, double before, double after, double floor) {
+        if (after > before * (1.0 + tolerance) && after - before > floor) {
+            std::ostringstream ss;
+            ss << name << ": " << before << " -> " << after;
+            regressions.push_back(ss.str());
+        }
+    };
+
+    if (baseline.contains("methods")) {
+        for (const auto& [method, before] : baseline["methods"].items()) {
+            if (!current["methods"].contains(method)) continue;
+            const auto& after = current["methods"][method];
+            check(method + " p50Us", before["p50Us"], after["p50Us"], NoiseFloorUs);
+            check(method + " p99Us", before["p99Us"], after["p99Us"], NoiseFloorUs);
+        }
+    }
+
+    if (baseline.contains("scan")) {
+        check("scan seconds", baseline["scan"]["seconds"], current["scan"]["seconds"], 0.01);
+    }
+    if (baseline.contains("peakResidentBytes")) {
+        check("peak RSS bytes", baseline["peakResidentBytes"], current["peakResidentBytes"], 4.0 * 1024 * 1024);
+    }
+    if (baseline.contains("throughput")) {
+        // 처리량은 낮아질수록 회귀
+        double before = baseline["throughput"]["messagesPerSecond"];
+        double after = current["throughput"]["messagesPerSecond"];
+        if (after * (1.0 + tolerance) < before) {
+            std::ostringstream ss;
+            ss << "messages/s: " << before << " -> " << after;
+            regressions.push_back(ss.str());
+        }
+    }
+
+    return regressions;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    ReplayOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+        // 잘못된 값이면 사용법을 보여주고 종료 (예외로 중단하지 않음)
+        bool invalid = false;
+        auto count = [&](size_t& target) {
+            std::string text = next();
+            if (auto value = parsePositive<size_t>(text)) {
+                target = *value;
+            } else {
+                std::cerr << "❌ " << arg << " expects a positive integer: " << text << std::endl;
+                invalid = true;
+            }
+        };
+
+        if (arg == "--help" || arg == "-h") { printUsage(argv[0]); return 0; }
+        else if (arg == "--session") options.sessionFiles.push_back(next());
+        else if (arg == "--corpus-dir") options.corpusDir = next();
+        else if (arg == "--headers") count(options.corpus.headersPerModule);
+        else if (arg == "--methods") count(options.corpus.methodsPerClass);
+        else if (arg == "--log-lines") count(options.corpus.logLines);
+        else if (arg == "--requests") count(options.requests);
+        else if (arg == "--iterations") count(options.iterations);
+        else if (arg == "--baseline") options.baselinePath = next();
+        else if (arg == "--tolerance") {
+            std::string text = next();
+            if (auto value = parseRatio(text)) {
+                options.tolerance = *value;
+            } else {
+                std::cerr << "❌ --tolerance expects a non-negative number: " << text << std::endl;
+                invalid = true;
+            }
+        }
+        else if (arg == "--write-baseline") options.writeBaselinePath = next();
+        else if (arg == "--output") options.outputPath = next();
+        else {
+            std::cerr << "❌ Unknown option: " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+        
+        if (invalid) {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (options.corpusDir.empty()) {
+        options.corpusDir = (fs::temp_directory_path() / "unreal-lsp-bench").string();
+    }
+
+    std::cerr << "🧪 Generating synthetic corpus in " << options.corpusDir << std::endl;
+    auto corpus = Benchmark::generateCorpus(options.corpusDir, options.corpus);
+
+    // 1) 엔진 헤더 스캔 처리량
+    EngineVersion version{5, 3, 2, "5.3.2", corpus.enginePath};
+    auto scanStart = std::chrono::steady_clock::now();
+    {
+        DynamicHeaderScanner scanner(version);
+        scanner.scanEngineHeaders();
+    }
+    double scanSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - scanStart).count();
+
+    // 2) 세션 재생
+    std::vector<std::string> sessions;
+    for (const auto& path : options.sessionFiles) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            std::cerr << "❌ Cannot open session: " << path << std::endl;
+            return 1;
+        }
+        sessions.emplace_back((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    }
+    if (sessions.empty()) {
+        sessions.push_back(Benchmark::generateSession(corpus, options.requests, options.corpus.seed));
+    }
+
+    LSPServer server;
+    size_t bytesWritten = 0;
+    server.setMessageWriter([&bytesWritten](const std::string& framed) { bytesWritten += framed.size(); });
+    server.initialize(corpus.projectPath, corpus.enginePath);
+    server.waitForIndexing();
+
+    // 엔진 인덱스가 비어 있으면 완성/정의 지연 시간이 의미 없으므로 중단
+    json startupStats = server.serverStats();
+    size_t engineIndexBytes = 0;
+    for (const auto& engine : startupStats["memory"]["engineIndexes"]) {
+        engineIndexBytes += engine.value("symbolTableBytes", size_t{0});
+    }
+    if (engineIndexBytes == 0) {
+        std::cerr << "❌ Synthetic engine was not indexed: " << corpus.enginePath << std::endl;
+        return 1;
+    }
+
+    // 메시지마다 프레임째 LSPServer::run 에 넣어 읽기 경로와 messages 카운터까지 재생
+    // (exit 는 서버를 멈추므로 제외)
+    struct FramedMessage {
+        std::string method;
+        std::string framed;
+    };
+    std::vector<std::vector<FramedMessage>> framedSessions;
+    for (const auto& session : sessions) {
+        auto& framedSession = framedSessions.emplace_back();
+        for (const auto& message : Benchmark::splitFramedMessages(session)) {
+            std::string method = json::parse(message).value("method", "");
+            if (method == "exit") continue;
+            framedSession.push_back({method, "Content-Length: " + std::to_string(message.size()) + "\r\n\r\n" + message});
+        }
+    }
+
+    std::map<std::string, std::vector<double>> samples;
+    size_t messageCount = 0;
+    std::istringstream input;
+    auto replayStart = std::chrono::steady_clock::now();
+
+    for (size_t iteration = 0; iteration < options.iterations; ++iteration) {
+        for (const auto& framedSession : framedSessions) {
+            for (const auto& message : framedSession) {
+                input.clear();
+                input.str(message.framed);
+
+                auto start = std::chrono::steady_clock::now();
+                server.run(input);
+                auto elapsed = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+                samples[message.method].push_back(elapsed);
+                ++messageCount;
+            }
+        }
+    }
+
+    double replaySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - replayStart).count();
+
+    json report;
+    report["methods"] = json::object();
+    for (auto& [method, values] : samples) {
+        report["methods"][method] = summarize(values);
+    }
+    report["throughput"] = {
+        {"messages", messageCount},
+        {"seconds", replaySeconds},
+        {"messagesPerSecond", replaySeconds > 0 ? static_cast<double>(messageCount) / replaySeconds : 0.0},
+        {"responseBytes", bytesWritten}
+    };
+    report["scan"] = {
+        {"files", options.corpus.modules * options.corpus.headersPerModule},
+        {"seconds", scanSeconds}
+    };
+    report["peakResidentBytes"] = Benchmark::peakResidentBytes();
+    report["serverStats"] = server.serverStats();
+
+    std::cout << report.dump(2) << std::endl;
+    if (!options.outputPath.empty()) {
+        std::ofstream(options.outputPath) << report.dump(2) << "\n";
+    }
+    if (!options.writeBaselinePath.empty()) {
+        json baseline = report;
+        baseline.erase("serverStats");
+        std::ofstream(options.writeBaselinePath) << baseline.dump(2) << "\n";
+    }
+
+    if (!options.baselinePath.empty()) {
+        std::ifstream file(options.baselinePath);
+        if (!file.is_open()) {
+            std::cerr << "❌ Cannot open baseline: " << options.baselinePath << std::endl;
+            return 1;
+        }
+        json baseline = json::parse(file);
+
+        auto regressions = findRegressions(baseline, report, options.tolerance);
+        if (!regressions.empty()) {
+            std::cerr << "❌ " << regressions.size() << " regression(s) against baseline:" << std::endl;
+            for (const auto& regression : regressions) {
+                std::cerr << "   " << regression << std::endl;
+            }
+            return 1;
+        }
+        std::cerr << "✅ No regressions against baseline" << std::endl;
+    }
+
+    return 0;
+}
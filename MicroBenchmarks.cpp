@@ -0,0 +1,333 @@
+#include "UnrealEngineLSP.hpp"
+#include "BenchmarkCorpus.hpp"
+#include <iomanip>
+
+using namespace UnrealEngine;
+
+// =============================================================================
+// 커널 마이크로 벤치마크
+// Google Benchmark 형태의 최소 하네스 (외부 의존성 없이 빌드)
+// =============================================================================
+
+namespace {
+
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+class BenchmarkState {
+public:
+    BenchmarkState(size_t range, size_t iterations) : range_(range), iterations_(iterations) {}
+
+    size_t range() const { return range_; }
+    size_t iterations() const { return iterations_; }
+    void setBytesProcessed(size_t bytes) { bytesProcessed_ = bytes; }
+    void setItemsProcessed(size_t items) { itemsProcessed_ = items; }
+    size_t bytesProcessed() const { return bytesProcessed_; }
+    size_t itemsProcessed() const { return itemsProcessed_; }
+    double elapsedSeconds() const { return std::chrono::duration<double>(stop_ - start_).count(); }
+
+    // for (auto _ : state) { ... } 루프 - 첫 반복 직전에 시작, 마지막 반복 뒤에 정지
+    struct Iterator {
+        BenchmarkState* state;
+        size_t remaining;
+
+        int operator*() const { return 0; }
+        Iterator& operator++() { --remaining; return *this; }
+        bool operator!=(const Iterator&) {
+            if (remaining != 0) return true;
+            state->stop_ = std::chrono::steady_clock::now();
+            return false;
+        }
+    };
+
+    Iterator begin() {
+        start_ = std::chrono::steady_clock::now();
+        return {this, iterations_};
+    }
+    Iterator end() { return {this, 0}; }
+
+private:
+    size_t range_;
+    size_t iterations_;
+    size_t bytesProcessed_ = 0;
+    size_t itemsProcessed_ = 0;
+    std::chrono::steady_clock::time_point start_;
+    std::chrono::steady_clock::time_point stop_;
+};
+
+struct BenchmarkCase {
+    std::string name;
+    std::function<void(BenchmarkState&)> function;
+    std::vector<size_t> ranges;
+};
+
+struct MicroOptions {
+    std::string filter;
+    double minSeconds = 0.5;
+    double scale = 1.0;
+    std::string jsonPath;
+    std::string workDir;
+};
+
+fs::path g_workDir;
+
+std::string writeInput(const std::string& name, const std::string& content) {
+    fs::path path = g_workDir / name;
+    fs::create_directories(path.parent_path());
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << content;
+    return path.string();
+}
+
+// 클래스 하나짜리 헤더 - range는 클래스당 메서드 수
+std::string headerWithMethods(size_t methods, std::vector<std::string>* classNames = nullptr) {
+    Benchmark::CorpusOptions options;
+    options.classesPerHeader = 1;
+    options.methodsPerClass = methods;
+    std::mt19937 random(42);
+    return Benchmark::generateHeader("ENGINE_API", "BenchActor", options, random, classNames);
+}
+
+EngineVersion benchmarkEngine() {
+    return EngineVersion{5, 3, 2, "5.3.2", (g_workDir / "EmptyEngine").string()};
+}
+
+// -----------------------------------------------------------------------------
+// 개별 커널
+// -----------------------------------------------------------------------------
+
+// 같은 내용의 헤더는 ParsedHeaderCache 에서 바로 나오므로 매 반복마다 비워서 파싱을 측정
+void benchScanHeaderFile(BenchmarkState& state) {
+    std::string content = headerWithMethods(state.range());
+    std::string path = writeInput("scan/BenchActor.h", content);
+    auto& parsedHeaders = ParsedHeaderCache::instance();
+
+    for ([[maybe_unused]] auto _ : state) {
+        parsedHeaders.clear();
+        DynamicHeaderScanner scanner(benchmarkEngine());
+        Benchmark::KernelAccess::scanHeaderFile(scanner, path);
+        doNotOptimize(scanner.memoryBytes());
+    }
+    state.setBytesProcessed(content.size() * state.iterations());
+}
+
+// 캐시 적중 경로 - 파일 읽기, 해시, 레코드 복사
+void benchScanHeaderFileCached(BenchmarkState& state) {
+    std::string content = headerWithMethods(state.range());
+    std::string path = writeInput("scan/BenchActorCached.h", content);
+    {
+        DynamicHeaderScanner scanner(benchmarkEngine());
+        Benchmark::KernelAccess::scanHeaderFile(scanner, path);
+    }
+
+    for ([[maybe_unused]] auto _ : state) {
+        DynamicHeaderScanner scanner(benchmarkEngine());
+        Benchmark::KernelAccess::scanHeaderFile(scanner, path);
+        doNotOptimize(scanner.memoryBytes());
+    }
+    state.setBytesProcessed(content.size() * state.iterations());
+}
+
+void benchExtractClassMethods(BenchmarkState& state) {
+    std::vector<std::string> classNames;
+    std::string content = headerWithMethods(state.range(), &classNames);
+    DynamicHeaderScanner scanner(benchmarkEngine());
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto methods = Benchmark::KernelAccess::extractClassMethods(scanner, content, classNames.front());
+        doNotOptimize(methods.data());
+    }
+    state.setBytesProcessed(content.size() * state.iterations());
+    state.setItemsProcessed(state.range() * state.iterations());
+}
+
+void benchAnalyzeLogFile(BenchmarkState& state) {
+    std::mt19937 random(7);
+    std::string content = Benchmark::generateLog(state.range(), random);
+    std::string path = writeInput("logs/Bench-" + std::to_string(state.range()) + ".log", content);
+    UnrealLogAnalyzer analyzer;
+
+    for ([[maybe_unused]] auto _ : state) {
+        auto issues = Benchmark::KernelAccess::analyzeLogFile(analyzer, path);
+        doNotOptimize(issues.data());
+    }
+    state.setBytesProcessed(content.size() * state.iterations());
+    state.setItemsProcessed(state.range() * state.iterations());
+}
+
+void benchInterpretError(BenchmarkState& state) {
+    std::mt19937 random(11);
+    auto errors = Benchmark::generateCompileErrors(state.range(), random);
+    CompileErrorInterpreter interpreter;
+
+    for ([[maybe_unused]] auto _ : state) {
+        for (const auto& message : errors) {
+            auto error = Benchmark::KernelAccess::interpretError(interpreter, message);
+            doNotOptimize(error.confidence);
+        }
+    }
+    state.setItemsProcessed(errors.size() * state.iterations());
+}
+
+// 자동완성은 엔진 인덱스가 필요 - range는 모듈당 헤더 수
+std::unique_ptr<VersionCompatibleAutoComplete> indexedAutoComplete(size_t headersPerModule,
+                                                                   Benchmark::GeneratedCorpus& corpus) {
+    Benchmark::CorpusOptions options;
+    options.headersPerModule = headersPerModule;
+    options.logLines = 0;
+    options.compileErrors = 0;
+    corpus = Benchmark::generateCorpus((g_workDir / ("completion-" + std::to_string(headersPerModule))).string(), options);
+
+    EngineVersion version{5, 3, 2, "5.3.2", corpus.enginePath};
+    auto autoComplete = std::make_unique<VersionCompatibleAutoComplete>(EngineIndexRegistry::instance().acquire(version));
+    autoComplete->waitForIndexing();
+    return autoComplete;
+}
+
+void benchGetCompletionsUncached(BenchmarkState& state) {
+    Benchmark::GeneratedCorpus corpus;
+    auto autoComplete = indexedAutoComplete(state.range(), corpus);
+    autoComplete->setCacheBudget(0);
+
+    size_t index = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        const std::string& className = corpus.classNames[index++ % corpus.classNames.size()];
+        auto completions = autoComplete->getCompletions("Get", className + "::");
+        doNotOptimize(completions->data());
+    }
+    state.setItemsProcessed(state.iterations());
+}
+
+void benchGetCompletionsCached(BenchmarkState& state) {
+    Benchmark::GeneratedCorpus corpus;
+    auto autoComplete = indexedAutoComplete(state.range(), corpus);
+
+    size_t index = 0;
+    for ([[maybe_unused]] auto _ : state) {
+        const std::string& className = corpus.classNames[index++ % 16 % corpus.classNames.size()];
+        auto completions = autoComplete->getCompletions("Get", className + "::");
+        doNotOptimize(completions->data());
+    }
+    state.setItemsProcessed(state.iterations());
+}
+
+// -----------------------------------------------------------------------------
+// 실행기
+// -----------------------------------------------------------------------------
+
+std::vector<BenchmarkCase> registeredBenchmarks() {
+    return {
+        {"DynamicHeaderScanner::scanHeaderFile", benchScanHeaderFile, {8, 64, 512}},
+        {"DynamicHeaderScanner::scanHeaderFile/cached", benchScanHeaderFileCached, {8, 64, 512}},
+        {"DynamicHeaderScanner::extractClassMethods", benchExtractClassMethods, {8, 64, 512}},
+        {"UnrealLogAnalyzer::analyzeLogFile", benchAnalyzeLogFile, {1000, 10000, 100000}},
+        {"CompileErrorInterpreter::interpretError", benchInterpretError, {100, 1000}},
+        {"VersionCompatibleAutoComplete::getCompletions/uncached", benchGetCompletionsUncached, {10, 100}},
+        {"VersionCompatibleAutoComplete::getCompletions/cached", benchGetCompletionsCached, {10, 100}}
+    };
+}
+
+// 최소 측정 시간을 넘길 때까지 반복 횟수를 늘려가며 실행
+json runBenchmark(const BenchmarkCase& benchmark, size_t range, double minSeconds) {
+    size_t iterations = 1;
+    while (true) {
+        BenchmarkState state(range, iterations);
+        benchmark.function(state);
+        double seconds = state.elapsedSeconds();
+
+        if (seconds >= minSeconds || iterations >= 1000000000) {
+            json result = {
+                {"name", benchmark.name + "/" + std::to_string(range)},
+                {"iterations", iterations},
+                {"nsPerIteration", seconds * 1e9 / static_cast<double>(iterations)}
+            };
+            if (state.bytesProcessed()) result["bytesPerSecond"] = static_cast<double>(state.bytesProcessed()) / seconds;
+            if (state.itemsProcessed()) result["itemsPerSecond"] = static_cast<double>(state.itemsProcessed()) / seconds;
+            return result;
+        }
+
+        double multiplier = seconds > 0 ? std::min(10.0, std::max(2.0, 1.4 * minSeconds / seconds)) : 10.0;
+        iterations = static_cast<size_t>(static_cast<double>(iterations) * multiplier);
+    }
+}
+
+std::string formatRate(double value, const char* unit) {
+    const char* prefixes[] = {"", "k", "M", "G"};
+    int prefix = 0;
+    while (value >= 1000.0 && prefix < 3) {
+        value /= 1000.0;
+        ++prefix;
+    }
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(1) << value << prefixes[prefix] << unit;
+    return ss.str();
+}
+
+void printUsage(const char* programName) {
+    std::cerr << "Usage: " << programName << " [options]\n";
+    std::cerr << "\nOptions:\n";
+    std::cerr << "  --filter <substring>   Only run benchmarks whose name contains the substring\n";
+    std::cerr << "  --min-time <seconds>   Minimum measured time per benchmark (default: 0.5)\n";
+    std::cerr << "  --scale <factor>       Multiply every input size by this factor (default: 1.0)\n";
+    std::cerr << "  --work-dir <path>      Where generated inputs are written\n";
+    std::cerr << "  --json <file>          Also write results as JSON\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    MicroOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string { return i + 1 < argc ? argv[++i] : ""; };
+
+        if (arg == "--help" || arg == "-h") { printUsage(argv[0]); return 0; }
+        else if (arg == "--filter") options.filter = next();
+        else if (arg == "--min-time") options.minSeconds = std::stod(next());
+        else if (arg == "--scale") options.scale = std::stod(next());
+        else if (arg == "--work-dir") options.workDir = next();
+        else if (arg == "--json") options.jsonPath = next();
+        else {
+            std::cerr << "❌ Unknown option: " << arg << std::endl;
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    g_workDir = options.workDir.empty() ? fs::temp_directory_path() / "unreal-lsp-micro" : fs::path(options.workDir);
+    fs::create_directories(g_workDir);
+
+    std::cout << std::left << std::setw(64) << "Benchmark"
+              << std::right << std::setw(14) << "ns/iter"
+              << std::setw(12) << "iters"
+              << std::setw(14) << "bytes/s"
+              << std::setw(14) << "items/s" << "\n";
+    std::cout << std::string(118, '-') << "\n";
+
+    json results = json::array();
+    for (const auto& benchmark : registeredBenchmarks()) {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) continue;
+
+        for (size_t range : benchmark.ranges) {
+            size_t scaled = std::max<size_t>(1, static_cast<size_t>(static_cast<double>(range) * options.scale));
+            json result = runBenchmark(benchmark, scaled, options.minSeconds);
+
+            std::cout << std::left << std::setw(64) << result["name"].get<std::string>()
+                      << std::right << std::setw(14) << std::fixed << std::setprecision(0)
+                      << result["nsPerIteration"].get<double>()
+                      << std::setw(12) << result["iterations"].get<size_t>()
+                      << std::setw(14) << (result.contains("bytesPerSecond") ? formatRate(result["bytesPerSecond"], "B") : "-")
+                      << std::setw(14) << (result.contains("itemsPerSecond") ? formatRate(result["itemsPerSecond"], "") : "-")
+                      << std::endl;
+            results.push_back(result);
+        }
+    }
+
+    if (!options.jsonPath.empty()) {
+        std::ofstream(options.jsonPath) << json{{"benchmarks", results}}.dump(2) << "\n";
+    }
+
+    return 0;
+}
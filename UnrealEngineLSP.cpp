@@ -1,4 +1,18 @@
 #include "UnrealEngineLSP.hpp"
+#include <cstring>
+#include <new>
+#include <sys/resource.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <csignal>
+#include <cerrno>
 
 namespace UnrealEngine {
 
@@ -8,13 +22,507 @@ static bool endsWith(const std::string& str, const std::string& suffix) {
            str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
 }
 
+static size_t peakResidentBytes() {
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#if defined(__APPLE__)
+    return static_cast<size_t>(usage.ru_maxrss);            // macOS: bytes
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;     // Linux: KB
+#endif
+}
+
+// file:// URI -> 로컬 경로 (%XX 디코딩 포함)
+static std::string uriToPath(const std::string& uri) {
+    std::string path = uri.compare(0, 7, "file://") == 0 ? uri.substr(7) : uri;
+    
+    std::string decoded;
+    decoded.reserve(path.size());
+    for (size_t i = 0; i < path.size(); ++i) {
+        if (path[i] == '%' && i + 2 < path.size() &&
+            std::isxdigit(static_cast<unsigned char>(path[i + 1])) &&
+            std::isxdigit(static_cast<unsigned char>(path[i + 2]))) {
+            decoded.push_back(static_cast<char>(std::stoi(path.substr(i + 1, 2), nullptr, 16)));
+            i += 2;
+        } else {
+            decoded.push_back(path[i]);
+        }
+    }
+    return decoded;
+}
+
+// 로컬 경로 -> file:// URI (RFC 3986 비예약 문자와 '/' 외에는 %XX 인코딩)
+static std::string pathToUri(const std::string& path) {
+    static const char* hex = "0123456789ABCDEF";
+    std::string uri = "file://";
+    uri.reserve(uri.size() + path.size());
+    for (char c : path) {
+        const auto byte = static_cast<unsigned char>(c);
+        if (std::isalnum(byte) || c == '/' || c == '-' || c == '.' || c == '_' || c == '~') {
+            uri.push_back(c);
+        } else {
+            uri.push_back('%');
+            uri.push_back(hex[byte >> 4]);
+            uri.push_back(hex[byte & 0xF]);
+        }
+    }
+    return uri;
+}
+
+// 워크스페이스 키 - 끝의 구분자를 뗀 정규화 경로
+static std::string normalizeRoot(const std::string& path) {
+    std::string root = fs::path(path).lexically_normal().string();
+    while (root.size() > 1 && root.back() == '/') root.pop_back();
+    return root;
+}
+
+// 폴더 바로 아래에 .uproject가 있으면 언리얼 프로젝트 루트
+static bool isUnrealProjectRoot(const std::string& path) {
+    std::error_code ec;
+    for (const auto& entry : fs::directory_iterator(path, ec)) {
+        if (entry.path().extension() == ".uproject") return true;
+    }
+    return false;
+}
+
+static int64_t steadyNowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// =============================================================================
+// ServerMetrics 구현
+// =============================================================================
+
+ServerMetrics& ServerMetrics::instance() {
+    static ServerMetrics metrics;
+    return metrics;
+}
+
+thread_local uint64_t ServerMetrics::allocationCount_ = 0;
+
+uint64_t ServerMetrics::threadAllocations() {
+    return allocationCount_;
+}
+
+ServerMetrics::ThreadBlock& ServerMetrics::localBlock() {
+    // 데몬 세션마다 스레드가 새로 생기므로 블록은 스레드 종료 때 돌려받아 다음 스레드가 재사용
+    struct Lease {
+        ThreadBlock* block = nullptr;
+        ~Lease() {
+            if (block) ServerMetrics::instance().releaseBlock(block);
+        }
+    };
+    thread_local Lease lease;
+    if (!lease.block) {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        if (!freeBlocks_.empty()) {
+            lease.block = freeBlocks_.back();
+            freeBlocks_.pop_back();
+        } else {
+            blocks_.push_back(std::make_unique<ThreadBlock>());
+            lease.block = blocks_.back().get();
+        }
+    }
+    return *lease.block;
+}
+
+void ServerMetrics::releaseBlock(ThreadBlock* block) {
+    // 스냅샷도 같은 잠금 아래에서 합산하므로 옮기는 도중의 값이 두 번 또는 0 번 세어지지 않음
+    std::lock_guard<std::mutex> lock(registryMutex_);
+    for (size_t slot = 0; slot < MaxSlots; ++slot) {
+        auto& from = block->histograms[slot];
+        auto& to = retired_.histograms[slot];
+        for (size_t b = 0; b < BucketCount; ++b) {
+            to.buckets[b].fetch_add(from.buckets[b].exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+        to.count.fetch_add(from.count.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        to.sumMicros.fetch_add(from.sumMicros.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        to.allocations.fetch_add(from.allocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        const uint64_t max = from.maxMicros.exchange(0, std::memory_order_relaxed);
+        if (max > to.maxMicros.load(std::memory_order_relaxed)) to.maxMicros.store(max, std::memory_order_relaxed);
+    }
+    for (size_t c = 0; c < block->counters.size(); ++c) {
+        retired_.counters[c].fetch_add(block->counters[c].exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    freeBlocks_.push_back(block);
+}
+
+size_t ServerMetrics::slot(std::string_view name) {
+    // 스레드마다 이미 찾은 이름을 기억 - 핫 패스(메시지마다)에서 잠금/문자열 생성 없음
+    thread_local std::map<std::string, size_t, std::less<>> cached;
+    auto cachedSlot = cached.find(name);
+    if (cachedSlot != cached.end()) return cachedSlot->second;
+    
+    const size_t found = registerSlot(name);
+    cached.emplace(std::string(name), found);
+    return found;
+}
+
+size_t ServerMetrics::registerSlot(std::string_view name) {
+    std::lock_guard<std::mutex> lock(registryMutex_);
+    auto it = slots_.find(name);
+    if (it != slots_.end()) return it->second;
+    
+    // 슬롯이 가득 차면 마지막 슬롯("other")에 합산
+    if (slotNames_.size() + 1 >= MaxSlots) {
+        if (slotNames_.size() + 1 == MaxSlots) slotNames_.push_back("other");
+        return MaxSlots - 1;
+    }
+    
+    slotNames_.emplace_back(name);
+    slots_.emplace(std::string(name), slotNames_.size() - 1);
+    return slotNames_.size() - 1;
+}
+
+size_t ServerMetrics::bucketFor(uint64_t micros) {
+    if (micros < 4) return static_cast<size_t>(micros);
+    size_t exponent = 63 - static_cast<size_t>(__builtin_clzll(micros));
+    size_t sub = static_cast<size_t>((micros >> (exponent - 2)) & 3);
+    return std::min((exponent - 1) * 4 + sub, BucketCount - 1);
+}
+
+uint64_t ServerMetrics::bucketUpperBound(size_t bucket) {
+    if (bucket < 4) return bucket;
+    size_t exponent = bucket / 4 + 1;
+    uint64_t sub = bucket % 4;
+    return ((uint64_t(4) + sub + 1) << (exponent - 2)) - 1;
+}
+
+void ServerMetrics::recordLatency(size_t slot, uint64_t micros, uint64_t allocations) {
+    auto& histogram = localBlock().histograms[std::min(slot, MaxSlots - 1)];
+    histogram.buckets[bucketFor(micros)].fetch_add(1, std::memory_order_relaxed);
+    histogram.count.fetch_add(1, std::memory_order_relaxed);
+    histogram.sumMicros.fetch_add(micros, std::memory_order_relaxed);
+    histogram.allocations.fetch_add(allocations, std::memory_order_relaxed);
+    // 자기 스레드 블록만 쓰므로 load/store로 충분
+    if (micros > histogram.maxMicros.load(std::memory_order_relaxed)) {
+        histogram.maxMicros.store(micros, std::memory_order_relaxed);
+    }
+}
+
+void ServerMetrics::addCounter(MetricCounter counter, uint64_t value) {
+    localBlock().counters[static_cast<size_t>(counter)].fetch_add(value, std::memory_order_relaxed);
+}
+
+json ServerMetrics::snapshot() const {
+    std::lock_guard<std::mutex> lock(registryMutex_);
+    
+    json latency = json::object();
+    for (size_t slot = 0; slot < slotNames_.size(); ++slot) {
+        std::array<uint64_t, BucketCount> buckets{};
+        uint64_t count = 0, sum = 0, max = 0, allocations = 0;
+        
+        auto add = [&](const ThreadBlock& block) {
+            const auto& histogram = block.histograms[slot];
+            for (size_t b = 0; b < BucketCount; ++b) {
+                buckets[b] += histogram.buckets[b].load(std::memory_order_relaxed);
+            }
+            count += histogram.count.load(std::memory_order_relaxed);
+            sum += histogram.sumMicros.load(std::memory_order_relaxed);
+            allocations += histogram.allocations.load(std::memory_order_relaxed);
+            max = std::max(max, histogram.maxMicros.load(std::memory_order_relaxed));
+        };
+        for (const auto& block : blocks_) add(*block);
+        add(retired_);
+        if (count == 0) continue;
+        
+        auto percentile = [&](double p) {
+            uint64_t rank = static_cast<uint64_t>(p * static_cast<double>(count - 1)) + 1;
+            uint64_t seen = 0;
+            for (size_t b = 0; b < BucketCount; ++b) {
+                seen += buckets[b];
+                if (seen >= rank) return std::min(bucketUpperBound(b), max);
+            }
+            return max;
+        };
+        
+        latency[slotNames_[slot]] = {
+            {"count", count},
+            {"meanUs", sum / count},
+            {"p50Us", percentile(0.50)},
+            {"p90Us", percentile(0.90)},
+            {"p99Us", percentile(0.99)},
+            {"maxUs", max},
+            {"allocationsPerCall", static_cast<double>(allocations) / static_cast<double>(count)}
+        };
+    }
+    
+    std::array<uint64_t, static_cast<size_t>(MetricCounter::Count)> counters{};
+    for (size_t c = 0; c < counters.size(); ++c) {
+        for (const auto& block : blocks_) counters[c] += block->counters[c].load(std::memory_order_relaxed);
+        counters[c] += retired_.counters[c].load(std::memory_order_relaxed);
+    }
+    
+    auto counter = [&](MetricCounter c) { return counters[static_cast<size_t>(c)]; };
+    double scanSeconds = static_cast<double>(counter(MetricCounter::ScanMicros)) / 1e6;
+    
+    return {
+        {"latency", latency},
+        {"messages", {
+            {"count", counter(MetricCounter::MessagesRead)},
+            {"bytes", counter(MetricCounter::BytesRead)}
+        }},
+        {"scan", {
+            {"files", counter(MetricCounter::FilesScanned)},
+            {"classesMaterialized", counter(MetricCounter::ClassesMaterialized)},
+            {"headersDeduplicated", counter(MetricCounter::HeadersDeduplicated)},
+            {"bytes", counter(MetricCounter::BytesScanned)},
+            {"seconds", scanSeconds},
+            {"filesPerSecond", scanSeconds > 0 ? static_cast<double>(counter(MetricCounter::FilesScanned)) / scanSeconds : 0.0},
+            {"megabytesPerSecond", scanSeconds > 0 ? static_cast<double>(counter(MetricCounter::BytesScanned)) / 1048576.0 / scanSeconds : 0.0}
+        }}
+    };
+}
+
+std::string ServerMetrics::summaryLine() const {
+    json stats = snapshot();
+    std::ostringstream ss;
+    ss << "[stats] messages=" << stats["messages"]["count"].get<uint64_t>()
+       << " scannedFiles=" << stats["scan"]["files"].get<uint64_t>();
+    for (const auto& [name, histogram] : stats["latency"].items()) {
+        ss << " " << name << "{n=" << histogram["count"].get<uint64_t>()
+           << " p50=" << histogram["p50Us"].get<uint64_t>() << "us"
+           << " p99=" << histogram["p99Us"].get<uint64_t>() << "us}";
+    }
+    return ss.str();
+}
+
+ServerMetrics::ScopedLatency::ScopedLatency(size_t slot)
+    : slot_(slot), start_(std::chrono::steady_clock::now()), allocationsAtStart_(allocationCount_) {}
+
+ServerMetrics::ScopedLatency::~ScopedLatency() {
+    auto micros = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_).count();
+    ServerMetrics::instance().recordLatency(slot_, static_cast<uint64_t>(micros), allocationCount_ - allocationsAtStart_);
+}
+
+// =============================================================================
+// TraceRecorder 구현
+// =============================================================================
+
+std::atomic<bool> TraceRecorder::enabled_{false};
+
+TraceRecorder& TraceRecorder::instance() {
+    static TraceRecorder recorder;
+    return recorder;
+}
+
+void TraceRecorder::start(const std::string& outputPath) {
+    outputPath_ = outputPath;
+    origin_ = std::chrono::steady_clock::now();
+    enabled_.store(true, std::memory_order_release);
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::localBuffer() {
+    // 링 하나가 수 MB 이므로 스레드 종료 때 돌려받아 다음 스레드가 이어서 기록 (같은 tid 로 표시)
+    struct Lease {
+        ThreadBuffer* buffer = nullptr;
+        ~Lease() {
+            if (buffer) TraceRecorder::instance().releaseBuffer(buffer);
+        }
+    };
+    thread_local Lease lease;
+    if (!lease.buffer) {
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        if (!freeBuffers_.empty()) {
+            lease.buffer = freeBuffers_.back();
+            freeBuffers_.pop_back();
+        } else {
+            auto owned = std::make_unique<ThreadBuffer>();
+            owned->events = std::make_unique<Event[]>(RingCapacity);
+            owned->threadId = static_cast<uint32_t>(buffers_.size() + 1);
+            lease.buffer = owned.get();
+            buffers_.push_back(std::move(owned));
+        }
+    }
+    return *lease.buffer;
+}
+
+void TraceRecorder::releaseBuffer(ThreadBuffer* buffer) {
+    std::lock_guard<std::mutex> lock(registryMutex_);
+    freeBuffers_.push_back(buffer);
+}
+
+void TraceRecorder::record(const char* name, const char* category, SymbolId detail,
+                           std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    auto& buffer = localBuffer();
+    uint64_t index = buffer.head.load(std::memory_order_relaxed);
+    
+    // 가득 차면 가장 오래된 이벤트를 덮어씀
+    auto& event = buffer.events[index & (RingCapacity - 1)];
+    event.sequence.store(2 * index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    event.name.store(name, std::memory_order_relaxed);
+    event.category.store(category, std::memory_order_relaxed);
+    event.detail.store(detail, std::memory_order_relaxed);
+    event.startMicros.store(static_cast<uint64_t>(std::max<int64_t>(0,
+        std::chrono::duration_cast<std::chrono::microseconds>(start - origin_).count())), std::memory_order_relaxed);
+    event.durationMicros.store(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()), std::memory_order_relaxed);
+    event.sequence.store(2 * index + 2, std::memory_order_release);
+    
+    buffer.head.store(index + 1, std::memory_order_release);
+}
+
+bool TraceRecorder::flush() {
+    if (!enabled() || outputPath_.empty()) return false;
+    
+    std::ofstream out(outputPath_, std::ios::trunc);
+    if (!out.is_open()) {
+        std::cerr << "Cannot write trace file: " << outputPath_ << std::endl;
+        return false;
+    }
+    
+    std::lock_guard<std::mutex> lock(registryMutex_);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    
+    bool first = true;
+    for (const auto& buffer : buffers_) {
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t count = std::min<uint64_t>(head, RingCapacity);
+        
+        out << (first ? "" : ",") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+            << ",\"args\":{\"name\":\"thread " << buffer->threadId << "\"}}";
+        first = false;
+        
+        for (uint64_t i = head - count; i < head; ++i) {
+            // 칸을 복사한 뒤 시퀀스가 그대로인지 확인 - 그 사이 덮어쓴 칸은 건너뜀
+            const auto& slot = buffer->events[i & (RingCapacity - 1)];
+            const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if (sequence != 2 * i + 2) continue;
+            const char* name = slot.name.load(std::memory_order_relaxed);
+            const char* category = slot.category.load(std::memory_order_relaxed);
+            const SymbolId detail = slot.detail.load(std::memory_order_relaxed);
+            const uint64_t startMicros = slot.startMicros.load(std::memory_order_relaxed);
+            const uint64_t durationMicros = slot.durationMicros.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(std::memory_order_relaxed) != sequence) continue;
+            
+            out << ",{\"name\":" << json(name).dump()
+                << ",\"cat\":" << json(category).dump()
+                << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId
+                << ",\"ts\":" << startMicros
+                << ",\"dur\":" << durationMicros;
+            if (detail != StringInterner::EmptyId) {
+                out << ",\"args\":{\"detail\":" << json(StringInterner::instance().view(detail)).dump() << "}";
+            }
+            out << "}";
+        }
+    }
+    
+    out << "]}\n";
+    return out.good();
+}
+
+// =============================================================================
+// StringArena / StringInterner 구현
+// =============================================================================
+
+StringArena::StringArena(size_t blockSize) : blockSize_(blockSize) {}
+
+std::string_view StringArena::store(std::string_view value) {
+    if (value.empty()) return std::string_view();
+    
+    if (value.size() > remaining_) {
+        // 큰 문자열은 전용 블록에 두어 현재 블록의 남은 공간을 버리지 않음
+        if (value.size() > blockSize_ / 4) {
+            blocks_.push_back(std::make_unique<char[]>(value.size()));
+            std::memcpy(blocks_.back().get(), value.data(), value.size());
+            bytesUsed_ += value.size();
+            bytesReserved_ += value.size();
+            return std::string_view(blocks_.back().get(), value.size());
+        }
+        
+        blocks_.push_back(std::make_unique<char[]>(blockSize_));
+        cursor_ = blocks_.back().get();
+        remaining_ = blockSize_;
+        bytesReserved_ += blockSize_;
+    }
+    
+    char* destination = cursor_;
+    std::memcpy(destination, value.data(), value.size());
+    cursor_ += value.size();
+    remaining_ -= value.size();
+    bytesUsed_ += value.size();
+    
+    return std::string_view(destination, value.size());
+}
+
+StringInterner& StringInterner::instance() {
+    static StringInterner interner;
+    return interner;
+}
+
+StringInterner::StringInterner() {
+    intern(std::string_view());     // id 0 = 빈 문자열
+}
+
+SymbolId StringInterner::intern(std::string_view value) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = ids_.find(value);
+        if (it != ids_.end()) return it->second;
+    }
+    
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = ids_.find(value);
+    if (it != ids_.end()) return it->second;
+    
+    size_t id = count_.load(std::memory_order_relaxed);
+    size_t page = id >> PageBits;
+    if (page >= MaxPages) {
+        throw std::length_error("StringInterner capacity exceeded");
+    }
+    
+    std::string_view* entries = pages_[page].load(std::memory_order_relaxed);
+    if (!entries) {
+        entries = new std::string_view[PageSize];
+        pages_[page].store(entries, std::memory_order_release);
+    }
+    
+    std::string_view stored = arena_.store(value);
+    entries[id & (PageSize - 1)] = stored;
+    ids_.emplace(stored, static_cast<SymbolId>(id));
+    count_.store(id + 1, std::memory_order_release);
+    
+    return static_cast<SymbolId>(id);
+}
+
+std::optional<SymbolId> StringInterner::find(std::string_view value) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = ids_.find(value);
+    if (it == ids_.end()) return std::nullopt;
+    return it->second;
+}
+
+std::string_view StringInterner::view(SymbolId id) const {
+    if (id >= count_.load(std::memory_order_acquire)) return std::string_view();
+    return pages_[id >> PageBits].load(std::memory_order_acquire)[id & (PageSize - 1)];
+}
+
+size_t StringInterner::bytesReserved() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    size_t pages = (count_.load(std::memory_order_relaxed) + PageSize - 1) >> PageBits;
+    return arena_.bytesReserved() + pages * PageSize * sizeof(std::string_view) +
+           ids_.size() * (sizeof(std::string_view) + sizeof(SymbolId) + sizeof(void*));
+}
+
 // =============================================================================
 // UnrealEngineDetector 구현
 // =============================================================================
 
-UnrealEngineDetector::UnrealEngineDetector() {
+std::unique_ptr<EngineInstallLocator> EngineInstallLocator::platformDefault() {
+#if defined(__APPLE__)
+    return std::make_unique<MacEngineInstallLocator>();
+#else
+    return std::make_unique<SourceBuildEngineInstallLocator>();
+#endif
+}
+
+std::vector<std::string> MacEngineInstallLocator::candidateRoots() const {
     // macOS 전용 - Epic Games Launcher 기본 설치 위치
-    commonInstallPaths_ = {
+    std::vector<std::string> roots = {
         "/Users/Shared/Epic Games",           // 공유 설치 (권장)
         "/Applications/Epic Games",           // 애플리케이션 폴더
         "/Applications/UnrealEngine",         // 직접 설치
@@ -31,23 +539,49 @@ UnrealEngineDetector::UnrealEngineDetector() {
         std::string homeStr(home);
         
         // macOS 사용자별 경로
-        commonInstallPaths_.push_back(homeStr + "/Library/Epic Games");
-        commonInstallPaths_.push_back(homeStr + "/Epic Games");
-        commonInstallPaths_.push_back(homeStr + "/UnrealEngine");
-        commonInstallPaths_.push_back(homeStr + "/Applications/Epic Games");
-        commonInstallPaths_.push_back(homeStr + "/Documents/Epic Games");
-        commonInstallPaths_.push_back(homeStr + "/Documents/UnrealEngine");
+        roots.push_back(homeStr + "/Library/Epic Games");
+        roots.push_back(homeStr + "/Epic Games");
+        roots.push_back(homeStr + "/UnrealEngine");
+        roots.push_back(homeStr + "/Applications/Epic Games");
+        roots.push_back(homeStr + "/Documents/Epic Games");
+        roots.push_back(homeStr + "/Documents/UnrealEngine");
         
         // 버전별 경로도 추가
         for (int major = 5; major <= 5; ++major) {
             for (int minor = 0; minor <= 5; ++minor) {
-                commonInstallPaths_.push_back(homeStr + "/UnrealEngine/UE_" +
+                roots.push_back(homeStr + "/UnrealEngine/UE_" +
                     std::to_string(major) + "." + std::to_string(minor));
             }
         }
     }
+    
+    return roots;
+}
+
+std::vector<std::string> SourceBuildEngineInstallLocator::candidateRoots() const {
+    // 런처가 없으므로 GitHub 소스 빌드를 두는 일반적인 위치
+    std::vector<std::string> roots = {
+        "/opt/UnrealEngine",
+        "/opt/Epic Games",
+        "/usr/local/UnrealEngine"
+    };
+    
+    if (const char* home = getenv("HOME")) {
+        std::string homeStr(home);
+        roots.push_back(homeStr + "/UnrealEngine");
+        roots.push_back(homeStr + "/Epic Games");
+        roots.push_back(homeStr + "/src/UnrealEngine");
+    }
+    
+    return roots;
 }
 
+UnrealEngineDetector::UnrealEngineDetector()
+    : UnrealEngineDetector(*EngineInstallLocator::platformDefault()) {}
+
+UnrealEngineDetector::UnrealEngineDetector(const EngineInstallLocator& locator)
+    : commonInstallPaths_(locator.candidateRoots()) {}
+
 std::vector<EngineVersion> UnrealEngineDetector::findAllEngineVersions() {
     std::vector<EngineVersion> versions;
     
@@ -343,47 +877,48 @@ void VersionSpecificAPI::initializeAPIDatabase() {
     apiDatabase_["5.5"] = apiDatabase_["5.4"];
 }
 
-std::vector<std::string> VersionSpecificAPI::getClassMethods(const std::string& className, const EngineVersion& version) {
-    std::string versionKey = getVersionKey(version);
+// 여러 프로젝트가 공유하므로 조회는 테이블을 변경하지 않는 const 접근만 사용
+const json* VersionSpecificAPI::findEntry(const EngineVersion& version, const char* section, const std::string& name) const {
+    auto versionIt = apiDatabase_.find(getVersionKey(version));
+    if (versionIt == apiDatabase_.end()) return nullptr;
     
-    if (apiDatabase_.find(versionKey) != apiDatabase_.end() &&
-        apiDatabase_[versionKey].find("classes") != apiDatabase_[versionKey].end() &&
-        apiDatabase_[versionKey]["classes"].find(className) != apiDatabase_[versionKey]["classes"].end()) {
-        
-        auto methods = apiDatabase_[versionKey]["classes"][className]["methods"];
-        return methods.get<std::vector<std::string>>();
+    auto sectionIt = versionIt->second.find(section);
+    if (sectionIt == versionIt->second.end()) return nullptr;
+    if (name.empty()) return &*sectionIt;
+    
+    auto entryIt = sectionIt->find(name);
+    return entryIt == sectionIt->end() ? nullptr : &*entryIt;
+}
+
+std::vector<std::string> VersionSpecificAPI::getClassMethods(const std::string& className, const EngineVersion& version) const {
+    if (const json* entry = findEntry(version, "classes", className)) {
+        if (entry->contains("methods")) {
+            return entry->at("methods").get<std::vector<std::string>>();
+        }
     }
     
     return getDefaultClassMethods(className);
 }
 
-std::string VersionSpecificAPI::getMacroTemplate(const std::string& macroName, const EngineVersion& version) {
-    std::string versionKey = getVersionKey(version);
-    
-    if (apiDatabase_.find(versionKey) != apiDatabase_.end() &&
-        apiDatabase_[versionKey].find("macros") != apiDatabase_[versionKey].end() &&
-        apiDatabase_[versionKey]["macros"].find(macroName) != apiDatabase_[versionKey]["macros"].end()) {
-        
-        return apiDatabase_[versionKey]["macros"][macroName]["template"];
+std::string VersionSpecificAPI::getMacroTemplate(const std::string& macroName, const EngineVersion& version) const {
+    if (const json* entry = findEntry(version, "macros", macroName)) {
+        if (entry->contains("template")) {
+            return entry->at("template").get<std::string>();
+        }
     }
     
     return getDefaultMacroTemplate(macroName, version);
 }
 
-std::vector<std::string> VersionSpecificAPI::getIncludePaths(const EngineVersion& version) {
-    std::string versionKey = getVersionKey(version);
-    
-    if (apiDatabase_.find(versionKey) != apiDatabase_.end() &&
-        apiDatabase_[versionKey].find("includePaths") != apiDatabase_[versionKey].end()) {
-        
-        auto paths = apiDatabase_[versionKey]["includePaths"];
-        return paths.get<std::vector<std::string>>();
+std::vector<std::string> VersionSpecificAPI::getIncludePaths(const EngineVersion& version) const {
+    if (const json* paths = findEntry(version, "includePaths", "")) {
+        return paths->get<std::vector<std::string>>();
     }
     
     return getDefaultIncludePaths(version);
 }
 
-std::string VersionSpecificAPI::getVersionKey(const EngineVersion& version) {
+std::string VersionSpecificAPI::getVersionKey(const EngineVersion& version) const {
     if (version.isUE4()) {
         return "4.27";
     } else if (version.major == 5) {
@@ -398,7 +933,7 @@ std::string VersionSpecificAPI::getVersionKey(const EngineVersion& version) {
     return "5.3"; // 기본값
 }
 
-std::vector<std::string> VersionSpecificAPI::getDefaultClassMethods(const std::string& className) {
+std::vector<std::string> VersionSpecificAPI::getDefaultClassMethods(const std::string& className) const {
     if (className == "AActor") {
         return {"BeginPlay", "EndPlay", "Tick", "GetActorLocation", "SetActorLocation"};
     } else if (className == "UObject") {
@@ -412,7 +947,7 @@ std::vector<std::string> VersionSpecificAPI::getDefaultClassMethods(const std::s
     return {};
 }
 
-std::string VersionSpecificAPI::getDefaultMacroTemplate(const std::string& macroName, const EngineVersion& version) {
+std::string VersionSpecificAPI::getDefaultMacroTemplate(const std::string& macroName, const EngineVersion& version) const {
     if (macroName == "UCLASS") {
         if (version.isUE4()) {
             return "UCLASS(BlueprintType, Blueprintable)\nclass GAME_API AClassName : public AActor\n{\n\tGENERATED_UCLASS_BODY()\n\n};";
@@ -434,7 +969,7 @@ std::string VersionSpecificAPI::getDefaultMacroTemplate(const std::string& macro
     return "";
 }
 
-std::vector<std::string> VersionSpecificAPI::getDefaultIncludePaths(const EngineVersion& version) {
+std::vector<std::string> VersionSpecificAPI::getDefaultIncludePaths(const EngineVersion& version) const {
     std::vector<std::string> paths = {
         "Engine/Source/Runtime/Core/Public",
         "Engine/Source/Runtime/CoreUObject/Public",
@@ -452,808 +987,6129 @@ std::vector<std::string> VersionSpecificAPI::getDefaultIncludePaths(const Engine
 }
 
 // =============================================================================
-// DynamicHeaderScanner 구현
+// SymbolTable 구현
 // =============================================================================
 
-DynamicHeaderScanner::DynamicHeaderScanner(const EngineVersion& version) : engineVersion_(version) {
-    enginePath_ = version.installPath;
+uint32_t SymbolTable::characterMask(std::string_view text) {
+    // a-z (대소문자 무시) -> 비트 0-25, 숫자 -> 26, '_' -> 27
+    uint32_t mask = 0;
+    for (char c : text) {
+        unsigned char u = static_cast<unsigned char>(c);
+        if (u >= 'A' && u <= 'Z') mask |= 1u << (u - 'A');
+        else if (u >= 'a' && u <= 'z') mask |= 1u << (u - 'a');
+        else if (u >= '0' && u <= '9') mask |= 1u << 26;
+        else if (u == '_') mask |= 1u << 27;
+    }
+    return mask;
 }
 
-void DynamicHeaderScanner::scanEngineHeaders() {
-    if (enginePath_.empty()) return;
-    
-    auto includePaths = getEnginePaths();
-    
-    for (const auto& includePath : includePaths) {
-        std::string fullPath = enginePath_ + "/" + includePath;
-        if (fs::exists(fullPath)) {
-            scanDirectory(fullPath);
-        }
+SymbolTable::RowId SymbolTable::add(const SymbolRecord& record) {
+    names_.push_back(record.name);
+    kinds_.push_back(static_cast<uint8_t>(record.kind));
+    owners_.push_back(record.owner);
+    files_.push_back(record.file);
+    startLines_.push_back(record.startLine);
+    endLines_.push_back(record.endLine);
+    flags_.push_back(record.flags);
+    types_.push_back(record.type);
+    nameMasks_.push_back(characterMask(StringInterner::instance().view(record.name)));
+    ++fileRows_[record.file];
+    return static_cast<RowId>(names_.size() - 1);
+}
+
+void SymbolTable::append(const std::vector<SymbolRecord>& records) {
+    for (const auto& record : records) {
+        add(record);
     }
 }
 
-std::vector<std::string> DynamicHeaderScanner::getClassMethods(const std::string& className) {
-    if (scannedClasses_.find(className) != scannedClasses_.end()) {
-        return scannedClasses_[className];
+void SymbolTable::removeFile(SymbolId file) {
+    // 처음 스캔하는 파일은 지울 행이 없음 - 전체 압축 없이 바로 반환
+    if (fileRows_.erase(file) == 0) return;
+    
+    // 해당 파일의 행을 제외하고 모든 컬럼을 같은 순서로 압축
+    size_t out = 0;
+    for (size_t i = 0; i < files_.size(); ++i) {
+        if (files_[i] == file) continue;
+        if (out != i) {
+            names_[out] = names_[i];
+            kinds_[out] = kinds_[i];
+            owners_[out] = owners_[i];
+            files_[out] = files_[i];
+            startLines_[out] = startLines_[i];
+            endLines_[out] = endLines_[i];
+            flags_[out] = flags_[i];
+            types_[out] = types_[i];
+            nameMasks_[out] = nameMasks_[i];
+        }
+        ++out;
     }
     
-    return {};
+    names_.resize(out);
+    kinds_.resize(out);
+    owners_.resize(out);
+    files_.resize(out);
+    startLines_.resize(out);
+    endLines_.resize(out);
+    flags_.resize(out);
+    types_.resize(out);
+    nameMasks_.resize(out);
 }
 
-std::vector<std::string> DynamicHeaderScanner::getEnginePaths() {
-    VersionSpecificAPI api;
-    return api.getIncludePaths(engineVersion_);
+void SymbolTable::clear() {
+    names_.clear();
+    kinds_.clear();
+    owners_.clear();
+    files_.clear();
+    startLines_.clear();
+    endLines_.clear();
+    flags_.clear();
+    types_.clear();
+    nameMasks_.clear();
+    fileRows_.clear();
 }
 
-void DynamicHeaderScanner::scanDirectory(const std::string& dirPath) {
-    try {
-        for (const auto& entry : fs::recursive_directory_iterator(dirPath)) {
-            if (entry.is_regular_file() && entry.path().extension() == ".h") {
-                scanHeaderFile(entry.path().string());
-            }
+SymbolRecord SymbolTable::row(RowId row) const {
+    SymbolRecord record;
+    record.name = names_[row];
+    record.kind = static_cast<SymbolKind>(kinds_[row]);
+    record.owner = owners_[row];
+    record.file = files_[row];
+    record.startLine = startLines_[row];
+    record.endLine = endLines_[row];
+    record.flags = flags_[row];
+    record.type = types_[row];
+    return record;
+}
+
+std::vector<SymbolTable::RowId> SymbolTable::rowsOwnedBy(SymbolId owner, SymbolKind kind) const {
+    std::vector<RowId> rows;
+    const size_t count = owners_.size();
+    const SymbolId* owners = owners_.data();
+    const uint8_t* kinds = kinds_.data();
+    const uint8_t wantedKind = static_cast<uint8_t>(kind);
+    
+    for (size_t i = 0; i < count; ++i) {
+        if ((owners[i] == owner) & (kinds[i] == wantedKind)) {
+            rows.push_back(static_cast<RowId>(i));
         }
-    } catch (const fs::filesystem_error&) {
-        // 권한 오류 등 무시
     }
+    
+    return rows;
+}
+
+std::vector<SymbolTable::RowId> SymbolTable::rowsOfKind(SymbolKind kind) const {
+    std::vector<RowId> rows;
+    const uint8_t wantedKind = static_cast<uint8_t>(kind);
+    for (size_t i = 0; i < kinds_.size(); ++i) {
+        if (kinds_[i] == wantedKind) rows.push_back(static_cast<RowId>(i));
+    }
+    return rows;
 }
 
-void DynamicHeaderScanner::scanHeaderFile(const std::string& filePath) {
-    std::ifstream file(filePath);
-    if (!file.is_open()) return;
-    
-    std::string content((std::istreambuf_iterator<char>(file)),
-                       std::istreambuf_iterator<char>());
-    
-    // 클래스 선언 찾기
-    std::regex classPattern(R"(class\s+\w+_API\s+(\w+)\s*:\s*public)");
-    std::smatch match;
-    
-    auto searchStart = content.cbegin();
-    while (std::regex_search(searchStart, content.cend(), match, classPattern)) {
-        std::string className = match[1].str();
-        
-        auto methods = extractClassMethods(content, className);
-        if (!methods.empty()) {
-            scannedClasses_[className] = methods;
-        }
-        
-        searchStart = match.suffix().first;
+std::vector<SymbolTable::RowId> SymbolTable::rowsNamed(SymbolId name) const {
+    std::vector<RowId> rows;
+    for (size_t i = 0; i < names_.size(); ++i) {
+        if (names_[i] == name) rows.push_back(static_cast<RowId>(i));
     }
+    return rows;
 }
 
-std::vector<std::string> DynamicHeaderScanner::extractClassMethods(const std::string& content, const std::string& className) {
-    std::vector<std::string> methods;
-    
-    std::regex methodPattern(R"(\s+(\w+)\s*\([^)]*\)\s*(?:const)?\s*(?:override)?\s*;)");
-    std::smatch match;
-    
-    auto searchStart = content.cbegin();
-    while (std::regex_search(searchStart, content.cend(), match, methodPattern)) {
-        std::string methodName = match[1].str();
-        
-        if (methodName != className &&
-            methodName[0] != '~' &&
-            methodName != "operator" &&
-            std::isupper(methodName[0])) {
-            
-            methods.push_back(methodName);
+std::vector<SymbolTable::RowId> SymbolTable::rowsWithFlags(SymbolKind kind, uint32_t mask) const {
+    std::vector<RowId> rows;
+    const size_t count = flags_.size();
+    const uint32_t* flags = flags_.data();
+    const uint8_t* kinds = kinds_.data();
+    const uint8_t wantedKind = static_cast<uint8_t>(kind);
+    
+    for (size_t i = 0; i < count; ++i) {
+        if ((kinds[i] == wantedKind) & ((flags[i] & mask) != 0)) {
+            rows.push_back(static_cast<RowId>(i));
         }
-        
-        searchStart = match.suffix().first;
     }
     
-    return methods;
+    return rows;
 }
 
-// =============================================================================
-// FunctionInfo 구현
-// =============================================================================
-
-std::string FunctionInfo::generateBlueprintWrapper() const {
-    std::ostringstream ss;
-    
-    ss << "UFUNCTION(BlueprintCallable, Category = \"Gameplay\")\n";
-    ss << returnType << " Blueprint_" << name << "(";
-    
-    for (size_t i = 0; i < parameters.size(); ++i) {
-        if (i > 0) ss << ", ";
-        ss << parameters[i];
+std::optional<int> SymbolTable::fuzzyScore(std::string_view name, SymbolKind kind, std::string_view query) {
+    auto lower = [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); };
+    size_t q = 0;
+    int score = 0;
+    int streak = 0;
+    for (size_t i = 0; i < name.size() && q < query.size(); ++i) {
+        if (lower(name[i]) == lower(query[q])) {
+            bool wordStart = i == 0 || std::isupper(static_cast<unsigned char>(name[i])) || name[i - 1] == '_';
+            score += 1 + (wordStart ? 4 : 0) + streak * 2 + (name[i] == query[q] ? 1 : 0);
+            ++streak;
+            ++q;
+        } else {
+            streak = 0;
+        }
     }
+    if (q != query.size()) return std::nullopt;
     
-    ss << ")\n{\n";
-    ss << "\t// Blueprint wrapper for " << name << "\n";
-    ss << "\treturn " << name << "(";
+    score -= static_cast<int>(name.size() - query.size()) / 4;
+    if (kind != SymbolKind::Function) score += 2;
+    return score;
+}
+
+std::vector<SymbolTable::RowId> SymbolTable::fuzzyMatch(std::string_view query, size_t limit) const {
+    const size_t count = nameMasks_.size();
+    const uint32_t queryMask = characterMask(query);
+    
+    // 1단계: 마스크 컬럼만 읽는 분기 없는 사전 필터
+    std::vector<RowId> candidates(count);
+    size_t candidateCount = 0;
+    const uint32_t* masks = nameMasks_.data();
+    for (size_t i = 0; i < count; ++i) {
+        candidates[candidateCount] = static_cast<RowId>(i);
+        candidateCount += (masks[i] & queryMask) == queryMask;
+    }
+    candidates.resize(candidateCount);
     
-    // 파라미터 이름만 추출하여 함수 호출
-    for (size_t i = 0; i < parameters.size(); ++i) {
-        if (i > 0) ss << ", ";
-        // 간단한 파라미터 이름 추출 (실제로는 더 정교한 파싱 필요)
-        size_t lastSpace = parameters[i].find_last_of(' ');
-        if (lastSpace != std::string::npos) {
-            ss << parameters[i].substr(lastSpace + 1);
-        }
+    // 2단계: 후보에 대해서만 문자열을 읽어 subsequence 확인 및 점수 계산
+    std::vector<std::pair<int, RowId>> scored;
+    for (RowId row : candidates) {
+        auto score = fuzzyScore(StringInterner::instance().view(names_[row]), static_cast<SymbolKind>(kinds_[row]), query);
+        if (score) scored.emplace_back(*score, row);
     }
     
-    ss << ");\n}\n";
+    size_t keep = std::min(limit, scored.size());
+    std::partial_sort(scored.begin(), scored.begin() + keep, scored.end(),
+        [](const auto& a, const auto& b) { return a.first != b.first ? a.first > b.first : a.second < b.second; });
     
-    return ss.str();
+    std::vector<RowId> rows;
+    rows.reserve(keep);
+    for (size_t i = 0; i < keep; ++i) {
+        rows.push_back(scored[i].second);
+    }
+    return rows;
+}
+
+void SymbolTable::compact() {
+    names_.shrink_to_fit();
+    kinds_.shrink_to_fit();
+    owners_.shrink_to_fit();
+    files_.shrink_to_fit();
+    startLines_.shrink_to_fit();
+    endLines_.shrink_to_fit();
+    flags_.shrink_to_fit();
+    types_.shrink_to_fit();
+    nameMasks_.shrink_to_fit();
+}
+
+size_t SymbolTable::memoryBytes() const {
+    return names_.capacity() * sizeof(SymbolId) + kinds_.capacity() * sizeof(uint8_t) +
+           owners_.capacity() * sizeof(SymbolId) + files_.capacity() * sizeof(SymbolId) +
+           startLines_.capacity() * sizeof(int32_t) + endLines_.capacity() * sizeof(int32_t) +
+           flags_.capacity() * sizeof(uint32_t) + types_.capacity() * sizeof(SymbolId) +
+           nameMasks_.capacity() * sizeof(uint32_t) +
+           fileRows_.size() * (sizeof(SymbolId) + sizeof(uint32_t) + 2 * sizeof(void*));
 }
 
 // =============================================================================
-// LogIssue 구현
+// ParsedHeaderCache 구현
 // =============================================================================
 
-std::string LogIssue::formatForDisplay() const {
-    std::ostringstream ss;
-    
-    ss << "// File: " << file << ":" << line << "\n";
-    ss << "// Type: ";
-    switch (type) {
-        case LogType::Performance: ss << "Performance"; break;
-        case LogType::Memory: ss << "Memory"; break;
-        case LogType::Error: ss << "Error"; break;
-        case LogType::Blueprint: ss << "Blueprint"; break;
-        case LogType::Warning: ss << "Warning"; break;
+ParsedHeaderCache& ParsedHeaderCache::instance() {
+    static ParsedHeaderCache cache;
+    return cache;
+}
+
+// xxHash64 의 단일 레인 변형 - 8바이트씩 곱셈/회전, 마지막에 avalanche
+uint64_t ParsedHeaderCache::contentHash(std::string_view content) {
+    constexpr uint64_t Prime1 = 0x9E3779B185EBCA87ULL;
+    constexpr uint64_t Prime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr uint64_t Prime3 = 0x165667B19E3779F9ULL;
+    auto rotl = [](uint64_t value, int bits) { return (value << bits) | (value >> (64 - bits)); };
+    
+    uint64_t hash = Prime3 + static_cast<uint64_t>(content.size()) * Prime1;
+    size_t i = 0;
+    for (; i + 8 <= content.size(); i += 8) {
+        uint64_t lane;
+        std::memcpy(&lane, content.data() + i, sizeof(lane));
+        hash ^= rotl(lane * Prime2, 31) * Prime1;
+        hash = rotl(hash, 27) * Prime1 + Prime2;
     }
-    ss << ", Severity: ";
-    switch (severity) {
-        case LogSeverity::Critical: ss << "Critical"; break;
-        case LogSeverity::High: ss << "High"; break;
-        case LogSeverity::Medium: ss << "Medium"; break;
-        case LogSeverity::Low: ss << "Low"; break;
+    for (; i < content.size(); ++i) {
+        hash ^= static_cast<uint64_t>(static_cast<unsigned char>(content[i])) * Prime3;
+        hash = rotl(hash, 11) * Prime1;
     }
-    ss << "\n";
-    ss << "// Message: " << message << "\n";
-    ss << "// Suggestion: " << suggestion << "\n";
     
-    return ss.str();
+    hash ^= hash >> 33;
+    hash *= Prime2;
+    hash ^= hash >> 29;
+    hash *= Prime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+void ParsedHeaderCache::store(uint64_t hash, std::vector<SymbolRecord> records) {
+    size_t bytes = sizeof(std::vector<SymbolRecord>) + records.capacity() * sizeof(SymbolRecord) + 64;
+    cache_.put(hash, std::make_shared<const std::vector<SymbolRecord>>(std::move(records)), bytes);
 }
 
 // =============================================================================
-// UnrealLogAnalyzer 구현
+// IndexScheduler 구현
 // =============================================================================
 
-UnrealLogAnalyzer::UnrealLogAnalyzer() {
-    initializePatterns();
+void IndexScheduler::enqueue(const std::vector<std::string>& files) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    state_ = State::Scanning;
+    
+    for (const auto& file : files) {
+        const SymbolId id = InternedString(file).id();
+        if (!pending_.emplace(id, IndexPriority::Background).second) continue;
+        queues_[static_cast<size_t>(IndexPriority::Background)].push_back(id);
+        
+        std::string fileName = fs::path(file).filename().string();
+        auto [begin, end] = byFileName_.equal_range(fileName);
+        if (std::none_of(begin, end, [id](const auto& entry) { return entry.second == id; })) {
+            byFileName_.emplace(std::move(fileName), id);
+        }
+    }
+    
+    // 목록이 오기 전에 열린 문서
+    auto deferred = std::move(deferredFocus_);
+    deferredFocus_.clear();
+    for (const auto& [includes, moduleRoot] : deferred) {
+        applyFocus(includes, moduleRoot);
+    }
 }
 
-void UnrealLogAnalyzer::initializePatterns() {
-    patterns_[LogType::Performance] = {
-        std::regex(R"(LogStats:\s+(.+)\s+took\s+(\d+\.?\d*)ms)"),
-        std::regex(R"(LogRenderer:\s+Frame\s+time:\s+(\d+\.?\d*)ms)"),
-        std::regex(R"(LogGameThread:\s+(.+)\s+(\d+\.?\d*)ms)"),
-        std::regex(R"(LogSlate:\s+Slow\s+widget\s+update.*(\d+\.?\d*)ms)")
-    };
+std::optional<IndexScheduler::Item> IndexScheduler::next() {
+    // 이미 스캔된 Focus 파일의 include 를 먼저 펼쳐서 대기 중인 파일을 Focus 로 올림
+    for (;;) {
+        std::string path;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (expand_.empty()) break;
+            path = InternedString::fromId(expand_.front()).str();
+            expand_.pop_front();
+        }
+        focusIncludesOf(path);
+    }
     
-    patterns_[LogType::Memory] = {
-        std::regex(R"(LogMemory:\s+(\d+)\s+bytes\s+leaked)"),
-        std::regex(R"(LogGC:\s+Garbage\s+collection\s+took\s+(\d+\.?\d*)ms)"),
-        std::regex(R"(LogMemory:\s+Out\s+of\s+memory)"),
-        std::regex(R"(LogMemory:\s+Allocation\s+failed.*size:\s+(\d+))")
-    };
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t tier = 0; tier < std::size(queues_); ++tier) {
+        auto& queue = queues_[tier];
+        while (!queue.empty()) {
+            const SymbolId id = queue.front();
+            queue.pop_front();
+            
+            // 더 높은 대기열로 승격됐거나 이미 꺼낸 항목은 건너뜀
+            auto it = pending_.find(id);
+            if (it == pending_.end() || static_cast<size_t>(it->second) != tier) continue;
+            pending_.erase(it);
+            
+            auto priority = static_cast<IndexPriority>(tier);
+            if (priority == IndexPriority::Focus) ++focusScanned_;
+            return Item{InternedString::fromId(id).str(), priority};
+        }
+    }
+    finishLocked();
+    return std::nullopt;
+}
+
+void IndexScheduler::focus(const std::vector<std::string>& includes, const std::string& moduleRoot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    switch (state_) {
+    case State::NotStarted:
+        if (deferredFocus_.size() >= MaxDeferredFocus) deferredFocus_.erase(deferredFocus_.begin());
+        deferredFocus_.emplace_back(includes, moduleRoot);
+        break;
+    case State::Scanning:
+        applyFocus(includes, moduleRoot);
+        break;
+    case State::Finished:
+        break;      // 앞당길 파일이 없음
+    }
+}
+
+void IndexScheduler::finish() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finishLocked();
+}
+
+void IndexScheduler::finishLocked() {
+    // 남은 스캔이 없으면 include 해석용 색인도 필요 없음 (오래 사는 데몬에서 계속 쌓이지 않도록)
+    state_ = State::Finished;
+    byFileName_.clear();
+    expand_.clear();
+    expanded_.clear();
+    deferredFocus_.clear();
+}
+
+void IndexScheduler::focusIncludesOf(const std::string& filePath) {
+    std::ifstream file(filePath);
+    if (!file.is_open()) return;
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    auto includes = parseIncludes(content);
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    expanded_.insert(InternedString(filePath).id());
+    for (const auto& include : includes) {
+        for (auto id : resolve(include)) {
+            focusFile(id);
+        }
+    }
+}
+
+void IndexScheduler::applyFocus(const std::vector<std::string>& includes, const std::string& moduleRoot) {
+    for (const auto& include : includes) {
+        for (auto id : resolve(include)) {
+            focusFile(id);
+        }
+    }
     
-    patterns_[LogType::Error] = {
-        std::regex(R"(LogTemp:\s+Error:\s+(.+))"),
-        std::regex(R"(LogCore:\s+Error:\s+(.+))"),
-        std::regex(R"(LogBlueprint:\s+Error:\s+(.+))"),
-        std::regex(R"(LogCompile:\s+Error:\s+(.+))"),
-        std::regex(R"(Error:\s+(.+))")
-    };
+    if (moduleRoot.empty()) return;
+    const std::string prefix = moduleRoot + "/";
+    std::vector<SymbolId> moduleFiles;
+    for (const auto& [id, priority] : pending_) {
+        if (priority == IndexPriority::Background &&
+            InternedString::fromId(id).view().compare(0, prefix.size(), prefix) == 0) {
+            moduleFiles.push_back(id);
+        }
+    }
+    std::sort(moduleFiles.begin(), moduleFiles.end(), [](SymbolId a, SymbolId b) {
+        return InternedString::fromId(a).view() < InternedString::fromId(b).view();
+    });
+    for (auto id : moduleFiles) {
+        promote(id, IndexPriority::Module);
+    }
+}
+
+void IndexScheduler::focusFile(SymbolId file) {
+    if (pending_.count(file)) {
+        promote(file, IndexPriority::Focus);
+    } else if (expanded_.insert(file).second) {
+        expand_.push_back(file);     // 이미 스캔됨 - include 만 따라감
+    }
+}
+
+void IndexScheduler::promote(SymbolId file, IndexPriority priority) {
+    auto it = pending_.find(file);
+    if (it == pending_.end() || it->second <= priority) return;
+    
+    it->second = priority;
+    auto& queue = queues_[static_cast<size_t>(priority)];
+    if (priority == IndexPriority::Focus) {
+        queue.push_front(file);     // 가장 최근에 연 문서의 include 부터
+    } else {
+        queue.push_back(file);
+    }
+    ++promotions_;
+}
+
+std::vector<SymbolId> IndexScheduler::resolve(std::string_view include) const {
+    std::vector<SymbolId> files;
+    if (!include.empty() && include.front() == '/') {
+        if (auto id = StringInterner::instance().find(include)) files.push_back(*id);
+        return files;
+    }
     
-    patterns_[LogType::Blueprint] = {
-        std::regex(R"(LogBlueprint:\s+(.+)\s+failed\s+to\s+compile)"),
-        std::regex(R"(LogBlueprintUserMessages:\s+(.+))"),
-        std::regex(R"(LogBlueprint:\s+Warning:\s+(.+))"),
-        std::regex(R"(Blueprint\s+compile\s+error:\s+(.+))")
-    };
+    size_t slash = include.rfind('/');
+    std::string fileName(slash == std::string_view::npos ? include : include.substr(slash + 1));
+    auto [begin, end] = byFileName_.equal_range(fileName);
+    for (auto it = begin; it != end; ++it) {
+        std::string_view path = InternedString::fromId(it->second).view();
+        // "GameFramework/Actor.h" 는 .../GameFramework/Actor.h 에만 일치
+        if (path.size() > include.size() && path.compare(path.size() - include.size(), include.size(), include) == 0 &&
+            path[path.size() - include.size() - 1] == '/') {
+            files.push_back(it->second);
+        }
+    }
+    return files;
+}
+
+std::vector<std::string> IndexScheduler::parseIncludes(std::string_view content) {
+    std::vector<std::string> includes;
+    size_t lineStart = 0;
+    while (lineStart < content.size()) {
+        size_t lineEnd = std::min(content.find('\n', lineStart), content.size());
+        std::string_view line = content.substr(lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+        
+        size_t pos = line.find_first_not_of(" \t");
+        if (pos == std::string_view::npos || line[pos] != '#') continue;
+        pos = line.find_first_not_of(" \t", pos + 1);
+        if (pos == std::string_view::npos || line.compare(pos, 7, "include") != 0) continue;
+        pos = line.find_first_of("\"<", pos + 7);
+        if (pos == std::string_view::npos) continue;
+        
+        size_t close = line.find(line[pos] == '"' ? '"' : '>', pos + 1);
+        if (close == std::string_view::npos || close == pos + 1) continue;
+        includes.emplace_back(line.substr(pos + 1, close - pos - 1));
+    }
+    return includes;
+}
+
+std::string IndexScheduler::moduleRootOf(const std::string& filePath) {
+    size_t source = filePath.rfind("/Source/");
+    size_t searchFrom = source == std::string::npos ? 0 : source;
+    size_t root = std::string::npos;
+    for (const char* marker : {"/Public/", "/Private/", "/Classes/", "/Internal/"}) {
+        root = std::min(root, filePath.find(marker, searchFrom));
+    }
+    if (root != std::string::npos) return filePath.substr(0, root);
     
-    patterns_[LogType::Warning] = {
-        std::regex(R"(LogTemp:\s+Warning:\s+(.+))"),
-        std::regex(R"(LogCore:\s+Warning:\s+(.+))"),
-        std::regex(R"(Warning:\s+(.+))")
+    size_t slash = filePath.rfind('/');
+    return slash == std::string::npos ? std::string() : filePath.substr(0, slash);
+}
+
+size_t IndexScheduler::pendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+}
+
+json IndexScheduler::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t counts[3] = {};
+    for (const auto& [id, priority] : pending_) {
+        ++counts[static_cast<size_t>(priority)];
+    }
+    return {
+        {"pendingFocus", counts[0]},
+        {"pendingModule", counts[1]},
+        {"pendingBackground", counts[2]},
+        {"focusScanned", focusScanned_},
+        {"promotions", promotions_}
     };
 }
 
-std::vector<LogIssue> UnrealLogAnalyzer::analyzeProject(const std::string& projectPath) {
-    std::vector<LogIssue> allIssues;
-    
-    auto logFiles = findLogFiles(projectPath);
-    
-    for (const auto& logFile : logFiles) {
-        auto issues = analyzeLogFile(logFile);
-        allIssues.insert(allIssues.end(), issues.begin(), issues.end());
+void IndexScheduler::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& queue : queues_) queue.clear();
+    pending_.clear();
+    byFileName_.clear();
+    expand_.clear();
+    expanded_.clear();
+    deferredFocus_.clear();
+    state_ = State::NotStarted;
+}
+
+// =============================================================================
+// DynamicHeaderScanner 구현
+// =============================================================================
+
+DynamicHeaderScanner::DynamicHeaderScanner(const EngineVersion& version) : engineVersion_(version) {
+    enginePath_ = version.installPath;
+}
+
+void DynamicHeaderScanner::scanDirectories(const std::vector<std::string>& directories) {
+    for (const auto& directory : directories) {
+        if (cancelled_) return;
+        if (fs::exists(directory)) {
+            scanDirectory(directory);
+        }
     }
-    
-    return allIssues;
 }
 
-std::string UnrealLogAnalyzer::generateAnalysisReport(const std::vector<LogIssue>& issues) {
-    std::ostringstream report;
+void DynamicHeaderScanner::scanEngineHeaders(size_t workers) {
+    if (enginePath_.empty()) {
+        scheduler_.finish();
+        return;
+    }
     
-    report << "/*\n";
-    report << " * UNREAL ENGINE LOG ANALYSIS REPORT\n";
-    report << " * Generated: " << std::chrono::system_clock::now().time_since_epoch().count() << "\n";
-    report << " * Total Issues Found: " << issues.size() << "\n";
-    report << " * ==========================================\n";
-    report << " */\n\n";
+    auto includePaths = getEnginePaths();
     
-    std::unordered_map<LogSeverity, std::vector<LogIssue>> groupedIssues;
-    for (const auto& issue : issues) {
-        groupedIssues[issue.severity].push_back(issue);
+    // 파일 목록을 먼저 모으고 대기열 우선순위 순서로 스캔 (열린 문서가 include 하는 헤더 먼저)
+    std::vector<std::string> files;
+    for (const auto& includePath : includePaths) {
+        std::string fullPath = enginePath_ + "/" + includePath;
+        try {
+            if (!fs::exists(fullPath)) continue;
+            for (const auto& entry : fs::recursive_directory_iterator(fullPath)) {
+                if (entry.is_regular_file() && entry.path().extension() == ".h") {
+                    files.push_back(entry.path().string());
+                }
+            }
+        } catch (const fs::filesystem_error&) {
+            // 권한 오류 등 무시
+        }
     }
+    std::sort(files.begin(), files.end());
+    files.erase(std::unique(files.begin(), files.end()), files.end());
     
-    for (auto severity : {LogSeverity::Critical, LogSeverity::High, LogSeverity::Medium, LogSeverity::Low}) {
-        if (groupedIssues[severity].empty()) continue;
-        
-        report << "// " << static_cast<int>(severity) << " SEVERITY ISSUES (" << groupedIssues[severity].size() << ")\n";
-        report << "// " << std::string(50, '=') << "\n";
-        
-        for (const auto& issue : groupedIssues[severity]) {
-            report << issue.formatForDisplay() << "\n";
+    scanFiles(files, workers);
+}
+
+void DynamicHeaderScanner::scanFiles(const std::vector<std::string>& files, size_t workers) {
+    scheduler_.enqueue(files);
+    
+    // 워커들이 대기열에서 하나씩 가져감 (테이블 추가만 잠금)
+    auto work = [this]() {
+        while (!cancelled_) {
+            auto item = scheduler_.next();
+            if (!item) return;
+            scanHeaderFile(item->path);
+            if (item->priority == IndexPriority::Focus) {
+                scheduler_.focusIncludesOf(item->path);     // 전이 include 도 Focus 로
+            }
         }
-        
-        report << "\n";
+    };
+    
+    if (workers <= 1) {
+        work();
+        return;
     }
     
-    return report.str();
+    std::vector<std::thread> threads;
+    for (size_t w = 0; w < std::min(workers, files.size()); ++w) {
+        threads.emplace_back(work);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
 }
 
-std::vector<std::string> UnrealLogAnalyzer::findLogFiles(const std::string& projectPath) {
-    std::vector<std::string> logFiles;
+std::vector<InternedString> DynamicHeaderScanner::getClassMethods(const std::string& className) {
+    auto classId = StringInterner::instance().find(className);
+    if (!classId) return {};
     
-    std::vector<std::string> logPaths = {
-        projectPath + "/Saved/Logs",
-        projectPath + "/Intermediate/Build/Win64/UnrealHeaderTool/Development/Engine/Logs"
-    };
+    if (lazy_) {
+        materializeClasses({*classId});
+    }
     
-    for (const auto& logPath : logPaths) {
-        if (fs::exists(logPath)) {
-            try {
-                for (const auto& entry : fs::directory_iterator(logPath)) {
-                    if (entry.is_regular_file() && entry.path().extension() == ".log") {
-                        logFiles.push_back(entry.path().string());
-                    }
-                }
-            } catch (const fs::filesystem_error&) {
-                // 권한 오류 등 무시
-            }
-        }
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<InternedString> methods;
+    for (auto row : symbols_.rowsOwnedBy(*classId, SymbolKind::Function)) {
+        methods.push_back(InternedString::fromId(symbols_.row(row).name));
     }
     
-    return logFiles;
+    return methods;
 }
 
-std::vector<LogIssue> UnrealLogAnalyzer::analyzeLogFile(const std::string& logFile) {
-    std::vector<LogIssue> issues;
+std::vector<SymbolRecord> DynamicHeaderScanner::getClassMembers(const std::string& className) {
+    auto classId = StringInterner::instance().find(className);
+    if (!classId) return {};
     
-    std::ifstream file(logFile);
-    if (!file.is_open()) return issues;
+    if (lazy_) {
+        materializeClasses({*classId});
+    }
     
-    std::string line;
-    int lineNum = 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<SymbolRecord> members;
+    for (auto kind : {SymbolKind::Function, SymbolKind::Typedef}) {
+        for (auto row : symbols_.rowsOwnedBy(*classId, kind)) {
+            members.push_back(symbols_.row(row));
+        }
+    }
     
-    while (std::getline(file, line)) {
-        lineNum++;
-        
-        for (const auto& [logType, patterns] : patterns_) {
-            for (const auto& pattern : patterns) {
-                std::smatch match;
-                if (std::regex_search(line, match, pattern)) {
-                    LogIssue issue;
-                    issue.type = logType;
-                    issue.message = match[0].str();
-                    issue.file = logFile;
-                    issue.line = lineNum;
-                    issue.severity = LogSeverity::Medium; // 기본값
-                    issue.suggestion = "Check the related code section";
-                    
-                    issues.push_back(issue);
-                    break;
-                }
-            }
+    return members;
+}
+
+std::vector<SymbolRecord> DynamicHeaderScanner::propertiesWithFlags(uint32_t mask) {
+    if (lazy_) {
+        // 지연 모드에서는 아직 파싱하지 않은 클래스의 프로퍼티가 없으므로 먼저 모두 파싱
+        // (이 스캐너는 사실상 지연 모드가 꺼짐 - 파일마다 한 번씩만 읽음)
+        std::vector<SymbolId> pending;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto& [classId, declarations] : pendingClasses_) pending.push_back(classId);
         }
+        materializeClasses(pending);
     }
     
-    return issues;
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<SymbolRecord> properties;
+    for (auto row : symbols_.rowsWithFlags(SymbolKind::Property, mask)) {
+        properties.push_back(symbols_.row(row));
+    }
+    return properties;
 }
 
-// =============================================================================
-// CompileError 구현
-// =============================================================================
+std::vector<SymbolRecord> DynamicHeaderScanner::classDeclarations() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<SymbolRecord> classes;
+    for (auto row : symbols_.rowsOfKind(SymbolKind::Class)) {
+        classes.push_back(symbols_.row(row));
+    }
+    return classes;
+}
 
-std::string CompileError::formatSolution() const {
-    std::ostringstream ss;
-    
-    ss << "// Error in " << file << ":" << line << "\n";
-    ss << "// Category: " << static_cast<int>(category) << "\n";
-    ss << "// Confidence: " << (confidence * 100) << "%\n";
-    ss << "// Message: " << message << "\n";
-    ss << "// Solution: " << solution << "\n";
+std::vector<SymbolRecord> DynamicHeaderScanner::symbolsNamed(SymbolId name) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<SymbolRecord> records;
+    for (auto row : symbols_.rowsNamed(name)) {
+        records.push_back(symbols_.row(row));
+    }
+    return records;
+}
+
+void DynamicHeaderScanner::rescanFile(const std::string& filePath) {
+    std::error_code ec;
+    if (fs::is_regular_file(filePath, ec)) {
+        scanHeaderFile(filePath);
+        return;
+    }
     
-    return ss.str();
+    std::lock_guard<std::mutex> lock(mutex_);
+    const SymbolId fileId = InternedString(filePath).id();
+    forgetLazyFile(fileId);
+    symbols_.removeFile(fileId);
+    generation_.fetch_add(1, std::memory_order_release);
 }
 
-// =============================================================================
-// CompileErrorInterpreter 구현
-// =============================================================================
+std::vector<SymbolRecord> DynamicHeaderScanner::findSymbols(std::string_view query, size_t limit) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<SymbolRecord> records;
+    for (auto row : symbols_.fuzzyMatch(query, limit)) {
+        records.push_back(symbols_.row(row));
+    }
+    return records;
+}
 
-CompileErrorInterpreter::CompileErrorInterpreter() {
-    initializePatterns();
+std::vector<std::string> DynamicHeaderScanner::getEnginePaths() {
+    VersionSpecificAPI api;
+    return api.getIncludePaths(engineVersion_);
 }
 
-void CompileErrorInterpreter::initializePatterns() {
-    patterns_ = {
-        {
-            std::regex(R"(error: use of undeclared identifier '(\w+)')"),
-            ErrorCategory::MissingInclude,
-            "Add #include for '{1}' or check spelling. Common includes for '{1}': CoreMinimal.h, Engine.h",
-            0.9
-        },
-        {
-            std::regex(R"(error: no member named '(\w+)' in)"),
-            ErrorCategory::MemberNotFound,
-            "Member '{1}' does not exist. Check spelling, access level, or add forward declaration",
-            0.8
-        },
-        {
-            std::regex(R"(error: UCLASS\(\) must be the first thing)"),
-            ErrorCategory::UnrealMacro,
-            "Move UCLASS() macro to immediately before class declaration",
-            0.95
-        },
+void DynamicHeaderScanner::scanDirectory(const std::string& dirPath) {
+    UNREAL_TRACE_SPAN_DETAIL("indexBatch", "indexer", dirPath);
+    
+    try {
+        for (const auto& entry : fs::recursive_directory_iterator(dirPath)) {
+            if (cancelled_) return;
+            if (entry.is_regular_file() && entry.path().extension() == ".h") {
+                scanHeaderFile(entry.path().string());
+            }
+        }
+    } catch (const fs::filesystem_error&) {
+        // 권한 오류 등 무시
+    }
+}
+
+namespace {
+
+SymbolRecord methodRecord(const FunctionInfo& method, SymbolId owner, SymbolId file) {
+    SymbolRecord record;
+    record.name = method.name.id();
+    record.kind = SymbolKind::Function;
+    record.owner = owner;
+    record.file = file;
+    record.startLine = method.location.range.start.line;
+    record.endLine = method.location.range.end.line;
+    if (method.signature.find("virtual ") != std::string::npos) record.flags |= SymbolFlags::Virtual;
+    if (method.signature.find("static ") != std::string::npos) record.flags |= SymbolFlags::Static;
+    if (method.signature.find(") const") != std::string::npos) record.flags |= SymbolFlags::Const;
+    if (method.signature.find("override") != std::string::npos) record.flags |= SymbolFlags::Override;
+    return record;
+}
+
+bool isIdentifierChar(char c) {
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+} // namespace
+
+void DynamicHeaderScanner::scanHeaderFile(const std::string& filePath) {
+    std::ifstream file(filePath);
+    if (!file.is_open()) return;
+    
+    UNREAL_TRACE_SPAN_DETAIL("scanHeader", "scanner", filePath);
+    auto scanStart = std::chrono::steady_clock::now();
+    std::string content((std::istreambuf_iterator<char>(file)),
+                       std::istreambuf_iterator<char>());
+    
+    const SymbolId fileId = InternedString(filePath).id();
+    
+    const uint64_t contentHash = lazy_ ? 0 : ParsedHeaderCache::contentHash(content);
+    
+    if (lazy_) {
+        indexClassDeclarations(fileId, content);
+    } else if (auto cached = ParsedHeaderCache::instance().find(contentHash)) {
+        // 다른 엔진 버전에서 같은 내용을 이미 파싱함 - 파일 id만 바꿔서 사용
+        std::vector<SymbolRecord> records(**cached);
+        for (auto& record : records) {
+            record.file = fileId;
+        }
+        
         {
-            std::regex(R"(error: GENERATED_BODY\(\) not found)"),
-            ErrorCategory::UnrealMacro,
-            "Add GENERATED_BODY() as first line inside UCLASS body",
-            0.95
-        },
+            std::lock_guard<std::mutex> lock(mutex_);
+            symbols_.removeFile(fileId);
+            symbols_.append(records);
+            generation_.fetch_add(1, std::memory_order_release);
+        }
+        ServerMetrics::instance().addCounter(MetricCounter::HeadersDeduplicated, 1);
+    } else {
+        std::vector<SymbolRecord> records;
+        
+        // 클래스 선언 찾기
+        std::regex classPattern(R"(class\s+\w+_API\s+(\w+)\s*:\s*public)");
+        std::smatch match;
+        
+        auto searchStart = content.cbegin();
+        int line = 0;
+        auto lineCursor = content.cbegin();
+        while (std::regex_search(searchStart, content.cend(), match, classPattern)) {
+            std::string className = match[1].str();
+            line += static_cast<int>(std::count(lineCursor, match[0].first, '\n'));
+            lineCursor = match[0].first;
+            
+            const size_t declarationOffset = static_cast<size_t>(match[0].first - content.cbegin());
+            auto methods = extractClassMethods(content, className, declarationOffset);
+            auto generated = synthesizeGeneratedMembers(content, className, fileId, declarationOffset);
+            auto properties = extractClassProperties(content, className, fileId, declarationOffset);
+            if (!methods.empty() || !generated.empty() || !properties.empty()) {
+                const SymbolId classId = InternedString(className).id();
+                
+                SymbolRecord classRecord;
+                classRecord.name = classId;
+                classRecord.kind = SymbolKind::Class;
+                classRecord.file = fileId;
+                classRecord.startLine = line;
+                classRecord.endLine = methods.empty() ? line : methods.back().location.range.end.line;
+                records.push_back(classRecord);
+                
+                for (const auto& method : methods) {
+                    records.push_back(methodRecord(method, classId, fileId));
+                }
+                records.insert(records.end(), generated.begin(), generated.end());
+                records.insert(records.end(), properties.begin(), properties.end());
+            }
+            
+            searchStart = match.suffix().first;
+        }
+        
         {
-            std::regex(R"(error: Cannot find definition for module '(\w+)')"),
-            ErrorCategory::ModuleNotFound,
-            "Add '{1}' to PublicDependencyModuleNames in your .Build.cs file",
-            0.9
+            std::lock_guard<std::mutex> lock(mutex_);
+            symbols_.removeFile(fileId);
+            symbols_.append(records);
+            generation_.fetch_add(1, std::memory_order_release);
+        }
+        
+        for (auto& record : records) {
+            record.file = StringInterner::EmptyId;
+        }
+        ParsedHeaderCache::instance().store(contentHash, std::move(records));
+    }
+    
+    auto& metrics = ServerMetrics::instance();
+    metrics.addCounter(MetricCounter::FilesScanned, 1);
+    metrics.addCounter(MetricCounter::BytesScanned, content.size());
+    metrics.addCounter(MetricCounter::ScanMicros, static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - scanStart).count()));
+}
+
+// 정규식 없이 "class XXX_API Name :" 만 찾아 클래스 행과 선언 위치를 기록
+void DynamicHeaderScanner::indexClassDeclarations(SymbolId fileId, const std::string& content) {
+    std::vector<SymbolRecord> records;
+    std::vector<std::pair<SymbolId, PendingClass>> declarations;
+    
+    int line = 0;
+    size_t lineCursor = 0;
+    size_t pos = 0;
+    while ((pos = content.find("_API", pos)) != std::string::npos) {
+        size_t macroEnd = pos + 4;
+        pos = macroEnd;
+        if (macroEnd >= content.size() || !std::isspace(static_cast<unsigned char>(content[macroEnd]))) continue;
+        
+        // 앞쪽: "class" + 공백 + 매크로 이름
+        size_t macroBegin = macroEnd - 4;
+        while (macroBegin > 0 && isIdentifierChar(content[macroBegin - 1])) --macroBegin;
+        size_t keywordEnd = content.find_last_not_of(" \t\r\n", macroBegin - 1);
+        if (macroBegin == 0 || keywordEnd == std::string::npos || keywordEnd == macroBegin - 1 || keywordEnd < 4 ||
+            content.compare(keywordEnd - 4, 5, "class") != 0 ||
+            (keywordEnd >= 5 && isIdentifierChar(content[keywordEnd - 5]))) {
+            continue;
+        }
+        
+        // 뒤쪽: 클래스 이름 + ':' (전방 선언 제외)
+        size_t nameBegin = content.find_first_not_of(" \t\r\n", macroEnd);
+        if (nameBegin == std::string::npos) break;
+        size_t nameEnd = nameBegin;
+        while (nameEnd < content.size() && isIdentifierChar(content[nameEnd])) ++nameEnd;
+        size_t next = content.find_first_not_of(" \t\r\n", nameEnd);
+        if (nameEnd == nameBegin || next == std::string::npos || content[next] != ':') continue;
+        
+        size_t declarationBegin = keywordEnd - 4;
+        line += static_cast<int>(std::count(content.begin() + lineCursor, content.begin() + declarationBegin, '\n'));
+        lineCursor = declarationBegin;
+        
+        const SymbolId classId = InternedString(std::string_view(content).substr(nameBegin, nameEnd - nameBegin)).id();
+        
+        SymbolRecord classRecord;
+        classRecord.name = classId;
+        classRecord.kind = SymbolKind::Class;
+        classRecord.file = fileId;
+        classRecord.startLine = line;
+        classRecord.endLine = line;
+        records.push_back(classRecord);
+        declarations.push_back({classId, PendingClass{fileId, declarationBegin, 0}});
+        
+        pos = nameEnd;
+    }
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    // 다시 스캔하는 파일이면 이전 선언 위치는 버림
+    forgetLazyFile(fileId);
+    
+    const uint64_t fileGeneration = generation_.fetch_add(1, std::memory_order_release) + 1;
+    auto& lazyFile = lazyFiles_[fileId];
+    lazyFile.generation = fileGeneration;
+    for (auto& [classId, declaration] : declarations) {
+        declaration.fileGeneration = fileGeneration;
+        pendingClasses_[classId].push_back(declaration);
+        lazyFile.classes.push_back(classId);
+    }
+    
+    symbols_.removeFile(fileId);
+    symbols_.append(records);
+}
+
+void DynamicHeaderScanner::forgetLazyFile(SymbolId fileId) {
+    auto previous = lazyFiles_.find(fileId);
+    if (previous == lazyFiles_.end()) return;
+    for (SymbolId classId : previous->second.classes) {
+        auto pending = pendingClasses_.find(classId);
+        if (pending == pendingClasses_.end()) continue;
+        auto& entries = pending->second;
+        entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                     [fileId](const PendingClass& entry) { return entry.file == fileId; }),
+                      entries.end());
+        if (entries.empty()) pendingClasses_.erase(pending);
+    }
+    lazyFiles_.erase(previous);
+}
+
+void DynamicHeaderScanner::materializeClasses(const std::vector<SymbolId>& classIds) {
+    std::lock_guard<std::mutex> materializeLock(materializeMutex_);
+    
+    // 파일별로 묶어 한 파일은 한 번만 읽음 (전체 파싱 시 같은 헤더의 클래스마다 다시 읽지 않도록)
+    std::unordered_map<SymbolId, std::vector<std::pair<SymbolId, PendingClass>>> byFile;
+    size_t materialized = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (SymbolId classId : classIds) {
+            auto it = pendingClasses_.find(classId);
+            if (it == pendingClasses_.end()) continue;   // 이미 파싱했거나 모르는 클래스
+            for (const auto& declaration : it->second) {
+                byFile[declaration.file].emplace_back(classId, declaration);
+            }
+            pendingClasses_.erase(it);
+            ++materialized;
+        }
+    }
+    if (materialized == 0) return;
+    
+    std::vector<std::pair<PendingClass, std::vector<SymbolRecord>>> parsed;
+    for (const auto& [fileId, declarations] : byFile) {
+        std::ifstream file(InternedString::fromId(fileId).str());
+        if (!file.is_open()) continue;
+        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        
+        for (const auto& [classId, declaration] : declarations) {
+            UNREAL_TRACE_SPAN("materializeClass", "scanner", classId);
+            const std::string className = InternedString::fromId(classId).str();
+            
+            std::vector<SymbolRecord> records;
+            for (const auto& method : extractClassMethods(content, className, declaration.offset)) {
+                records.push_back(methodRecord(method, classId, fileId));
+            }
+            auto generated = synthesizeGeneratedMembers(content, className, fileId, declaration.offset);
+            records.insert(records.end(), generated.begin(), generated.end());
+            auto properties = extractClassProperties(content, className, fileId, declaration.offset);
+            records.insert(records.end(), properties.begin(), properties.end());
+            parsed.emplace_back(declaration, std::move(records));
+        }
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto& [declaration, records] : parsed) {
+            // 파싱하는 사이 파일이 다시 스캔되었거나 지워졌으면 버림 (새 선언이 이미 대기 중)
+            auto lazyFile = lazyFiles_.find(declaration.file);
+            if (lazyFile == lazyFiles_.end() || lazyFile->second.generation != declaration.fileGeneration) continue;
+            symbols_.append(records);
+        }
+        generation_.fetch_add(1, std::memory_order_release);
+    }
+    ServerMetrics::instance().addCounter(MetricCounter::ClassesMaterialized, materialized);
+}
+
+std::vector<SymbolRecord> DynamicHeaderScanner::records() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<SymbolRecord> rows;
+    rows.reserve(symbols_.size());
+    for (SymbolTable::RowId row = 0; row < symbols_.size(); ++row) {
+        rows.push_back(symbols_.row(row));
+    }
+    return rows;
+}
+
+void DynamicHeaderScanner::adoptRecords(const std::vector<SymbolRecord>& records) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    symbols_.append(records);
+    generation_.fetch_add(1, std::memory_order_release);
+}
+
+size_t DynamicHeaderScanner::pendingClassCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pendingClasses_.size();
+}
+
+size_t DynamicHeaderScanner::memoryBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return symbols_.memoryBytes();
+}
+
+void DynamicHeaderScanner::compact() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    symbols_.compact();
+}
+
+namespace {
+
+// "class XXX_API ClassName ... {" 선언의 본문 범위 [open, close) 찾기
+bool findClassBody(const std::string& content, const std::string& className, size_t searchFrom,
+                   size_t& bodyBegin, size_t& bodyEnd) {
+    size_t pos = searchFrom;
+    while ((pos = content.find(className, pos)) != std::string::npos) {
+        size_t nameEnd = pos + className.size();
+        bool wholeWord = (nameEnd >= content.size() || !(std::isalnum(static_cast<unsigned char>(content[nameEnd])) || content[nameEnd] == '_')) &&
+                         pos > 0 && std::isspace(static_cast<unsigned char>(content[pos - 1]));
+        
+        // 바로 앞 토큰이 XXX_API 인지 확인
+        size_t tokenEnd = content.find_last_not_of(" \t\r\n", pos - 1);
+        bool afterApiMacro = tokenEnd != std::string::npos && tokenEnd >= 4 &&
+                             content.compare(tokenEnd - 3, 4, "_API") == 0;
+        
+        if (wholeWord && afterApiMacro) {
+            size_t open = content.find_first_of("{;", nameEnd);
+            if (open != std::string::npos && content[open] == '{') {
+                int depth = 0;
+                for (size_t i = open; i < content.size(); ++i) {
+                    if (content[i] == '{') ++depth;
+                    else if (content[i] == '}' && --depth == 0) {
+                        bodyBegin = open + 1;
+                        bodyEnd = i;
+                        return true;
+                    }
+                }
+            }
+        }
+        
+        pos = nameEnd;
+    }
+    return false;
+}
+
+} // namespace
+
+std::vector<FunctionInfo> DynamicHeaderScanner::extractClassMethods(const std::string& content, const std::string& className,
+                                                                    size_t declarationOffset) {
+    std::vector<FunctionInfo> methods;
+    
+    // 선언을 찾으면 해당 클래스 본문만, 못 찾으면 파일 전체를 검색
+    size_t bodyBegin = 0;
+    size_t bodyEnd = content.size();
+    if (!findClassBody(content, className, declarationOffset, bodyBegin, bodyEnd) && declarationOffset > 0) {
+        findClassBody(content, className, 0, bodyBegin, bodyEnd);   // 파일이 바뀌어 위치가 어긋난 경우
+    }
+    
+    std::regex methodPattern(R"(\s+(\w+)\s*\([^)]*\)\s*(?:const)?\s*(?:override)?\s*;)");
+    std::smatch match;
+    
+    auto searchStart = content.cbegin() + bodyBegin;
+    const auto searchEnd = content.cbegin() + bodyEnd;
+    int line = static_cast<int>(std::count(content.cbegin(), searchStart, '\n'));
+    auto lineCursor = searchStart;
+    
+    while (std::regex_search(searchStart, searchEnd, match, methodPattern)) {
+        std::string methodName = match[1].str();
+        
+        if (methodName != className &&
+            methodName[0] != '~' &&
+            methodName != "operator" &&
+            std::isupper(methodName[0])) {
+            
+            auto nameBegin = match[1].first;
+            line += static_cast<int>(std::count(lineCursor, nameBegin, '\n'));
+            lineCursor = nameBegin;
+            
+            // 선언이 있는 줄 전체를 시그니처로 보관
+            size_t offset = static_cast<size_t>(nameBegin - content.cbegin());
+            size_t lineStart = content.rfind('\n', offset);
+            lineStart = lineStart == std::string::npos ? 0 : lineStart + 1;
+            size_t declarationEnd = static_cast<size_t>(match[0].second - content.cbegin());
+            std::string signature = content.substr(lineStart, declarationEnd - lineStart);
+            size_t first = signature.find_first_not_of(" \t");
+            
+            FunctionInfo method;
+            method.name = InternedString(methodName);
+            method.signature = first == std::string::npos ? signature : signature.substr(first);
+            method.location.range.start = {line, static_cast<int>(offset - lineStart)};
+            method.location.range.end = {line + static_cast<int>(std::count(nameBegin, match[0].second, '\n')),
+                                         static_cast<int>(offset - lineStart + methodName.size())};
+            methods.push_back(std::move(method));
+        }
+        
+        searchStart = match.suffix().first;
+    }
+    
+    return methods;
+}
+
+namespace {
+
+// UFUNCTION(...) 괄호 안의 최상위 지정자 (meta=(...) 내부와 문자열은 제외)
+std::unordered_set<std::string_view> topLevelSpecifiers(std::string_view specifiers) {
+    std::unordered_set<std::string_view> tokens;
+    int depth = 0;
+    bool quoted = false;
+    size_t tokenBegin = std::string_view::npos;
+    for (size_t i = 0; i <= specifiers.size(); ++i) {
+        char c = i < specifiers.size() ? specifiers[i] : ',';
+        bool identifier = !quoted && depth == 0 && isIdentifierChar(c);
+        if (identifier && tokenBegin == std::string_view::npos) tokenBegin = i;
+        if (!identifier && tokenBegin != std::string_view::npos) {
+            tokens.insert(specifiers.substr(tokenBegin, i - tokenBegin));
+            tokenBegin = std::string_view::npos;
         }
+        if (c == '"') quoted = !quoted;
+        else if (!quoted && c == '(') ++depth;
+        else if (!quoted && c == ')') --depth;
+    }
+    return tokens;
+}
+
+} // namespace
+
+std::vector<SymbolRecord> DynamicHeaderScanner::synthesizeGeneratedMembers(const std::string& content, const std::string& className,
+                                                                           SymbolId fileId, size_t declarationOffset) {
+    std::vector<SymbolRecord> members;
+    
+    size_t bodyBegin = 0;
+    size_t bodyEnd = 0;
+    if (!findClassBody(content, className, declarationOffset, bodyBegin, bodyEnd)) return members;
+    
+    const std::string_view body = std::string_view(content).substr(bodyBegin, bodyEnd - bodyBegin);
+    size_t generatedBody = body.find("GENERATED_BODY(");
+    if (generatedBody == std::string_view::npos) generatedBody = body.find("GENERATED_UCLASS_BODY(");
+    if (generatedBody == std::string_view::npos) return members;
+    
+    const SymbolId classId = InternedString(className).id();
+    const int bodyLine = static_cast<int>(std::count(content.begin(), content.begin() + bodyBegin, '\n'));
+    int line = bodyLine + static_cast<int>(std::count(body.begin(), body.begin() + generatedBody, '\n'));
+    
+    auto add = [&](std::string_view name, SymbolKind kind, uint32_t flags) {
+        SymbolRecord record;
+        record.name = InternedString(name).id();
+        record.kind = kind;
+        record.owner = classId;
+        record.file = fileId;
+        record.startLine = line;
+        record.endLine = line;
+        record.flags = flags | SymbolFlags::Generated;
+        members.push_back(record);
     };
+    
+    add("StaticClass", SymbolKind::Function, SymbolFlags::Static);
+    add("Super", SymbolKind::Typedef, SymbolFlags::None);
+    add("ThisClass", SymbolKind::Typedef, SymbolFlags::None);
+    
+    // RPC 와 BlueprintNativeEvent 는 _Implementation, WithValidation 은 _Validate 를 사용자가 구현
+    line = bodyLine;
+    size_t lineCursor = 0;
+    size_t pos = 0;
+    while ((pos = body.find("UFUNCTION", pos)) != std::string_view::npos) {
+        size_t open = body.find_first_not_of(" \t", pos + 9);
+        pos += 9;
+        if (open == std::string_view::npos || body[open] != '(') continue;
+        
+        size_t close = open;
+        for (int depth = 0; close < body.size(); ++close) {
+            if (body[close] == '(') ++depth;
+            else if (body[close] == ')' && --depth == 0) break;
+        }
+        if (close >= body.size()) break;
+        
+        // 선언된 함수 이름: 매크로 뒤 첫 '(' 바로 앞 식별자
+        size_t parameters = body.find('(', close + 1);
+        if (parameters == std::string_view::npos) break;
+        size_t nameEnd = body.find_last_not_of(" \t\r\n", parameters - 1) + 1;
+        size_t nameBegin = nameEnd;
+        while (nameBegin > close + 1 && isIdentifierChar(body[nameBegin - 1])) --nameBegin;
+        pos = parameters;
+        if (nameBegin == nameEnd) continue;
+        
+        auto specifiers = topLevelSpecifiers(body.substr(open + 1, close - open - 1));
+        bool remote = specifiers.count("Server") || specifiers.count("Client") || specifiers.count("NetMulticast");
+        bool nativeEvent = specifiers.count("BlueprintNativeEvent") > 0;
+        if (!remote && !nativeEvent) continue;
+        
+        line += static_cast<int>(std::count(body.begin() + lineCursor, body.begin() + nameBegin, '\n'));
+        lineCursor = nameBegin;
+        
+        std::string name(body.substr(nameBegin, nameEnd - nameBegin));
+        add(name + "_Implementation", SymbolKind::Function, SymbolFlags::Virtual);
+        if (specifiers.count("WithValidation")) {
+            add(name + "_Validate", SymbolKind::Function, SymbolFlags::Virtual);
+        }
+    }
+    
+    return members;
+}
+
+// =============================================================================
+// UPROPERTY 리플렉션 메타데이터
+// =============================================================================
+
+namespace {
+
+constexpr std::pair<std::string_view, uint32_t> PropertySpecifiers[] = {
+    {"Replicated", PropertyFlags::Replicated},
+    {"ReplicatedUsing", PropertyFlags::Replicated | PropertyFlags::RepNotify},
+    {"NotReplicated", PropertyFlags::NotReplicated},
+    {"Transient", PropertyFlags::Transient},
+    {"SaveGame", PropertyFlags::SaveGame},
+    {"Config", PropertyFlags::Config},
+    {"GlobalConfig", PropertyFlags::Config},
+    {"EditAnywhere", PropertyFlags::EditAnywhere},
+    {"EditDefaultsOnly", PropertyFlags::EditDefaultsOnly},
+    {"EditInstanceOnly", PropertyFlags::EditInstanceOnly},
+    {"VisibleAnywhere", PropertyFlags::VisibleAnywhere},
+    {"BlueprintReadWrite", PropertyFlags::BlueprintReadWrite},
+    {"BlueprintReadOnly", PropertyFlags::BlueprintReadOnly},
+    {"BlueprintAssignable", PropertyFlags::BlueprintAssignable},
+    {"Instanced", PropertyFlags::Instanced},
+    {"DuplicateTransient", PropertyFlags::DuplicateTransient},
+    {"Interp", PropertyFlags::Interp},
+};
+
+// "TArray < class UFoo * >" -> "TArray<UFoo*>" (식별자 사이 공백만 하나 남김)
+std::string normalizePropertyType(std::string_view type) {
+    std::string normalized;
+    size_t i = 0;
+    while (i < type.size()) {
+        if (std::isspace(static_cast<unsigned char>(type[i]))) { ++i; continue; }
+        if (!isIdentifierChar(type[i])) { normalized += type[i++]; continue; }
+        
+        size_t end = i;
+        while (end < type.size() && isIdentifierChar(type[end])) ++end;
+        std::string_view word = type.substr(i, end - i);
+        i = end;
+        if (word == "class" || word == "struct" || word == "enum") continue;
+        if (!normalized.empty() && isIdentifierChar(normalized.back())) normalized += ' ';
+        normalized += word;
+    }
+    return normalized;
+}
+
+} // namespace
+
+uint32_t PropertyFlags::fromSpecifier(std::string_view specifier) {
+    for (const auto& [name, flags] : PropertySpecifiers) {
+        if (name == specifier) return flags;
+    }
+    return 0;
+}
+
+json PropertyFlags::toJson(uint32_t flags) {
+    json names = json::array();
+    for (const auto& [name, bits] : PropertySpecifiers) {
+        // ReplicatedUsing 은 Replicated 를 포함하므로 정확히 일치하는 이름 하나만
+        if (name == "GlobalConfig") continue;
+        if (name == "Replicated" && (flags & PropertyFlags::RepNotify)) continue;
+        if ((flags & bits) == bits) names.push_back(name);
+    }
+    return names;
+}
+
+std::vector<SymbolRecord> DynamicHeaderScanner::extractClassProperties(const std::string& content, const std::string& className,
+                                                                       SymbolId fileId, size_t declarationOffset) {
+    std::vector<SymbolRecord> properties;
+    
+    size_t bodyBegin = 0;
+    size_t bodyEnd = 0;
+    if (!findClassBody(content, className, declarationOffset, bodyBegin, bodyEnd)) return properties;
+    
+    const std::string_view body = std::string_view(content).substr(bodyBegin, bodyEnd - bodyBegin);
+    const SymbolId classId = InternedString(className).id();
+    int line = static_cast<int>(std::count(content.begin(), content.begin() + bodyBegin, '\n'));
+    size_t lineCursor = 0;
+    
+    size_t pos = 0;
+    while ((pos = body.find("UPROPERTY", pos)) != std::string_view::npos) {
+        size_t open = body.find_first_not_of(" \t", pos + 9);
+        pos += 9;
+        if (open == std::string_view::npos || body[open] != '(') continue;
+        
+        size_t close = open;
+        for (int depth = 0; close < body.size(); ++close) {
+            if (body[close] == '(') ++depth;
+            else if (body[close] == ')' && --depth == 0) break;
+        }
+        if (close >= body.size()) break;
+        
+        size_t semicolon = body.find(';', close + 1);
+        if (semicolon == std::string_view::npos) break;
+        pos = semicolon;
+        
+        // 선언부에서 기본값(= / {}), 비트필드(: 1), 배열 크기([N]) 를 떼어냄
+        std::string_view declaration = body.substr(close + 1, semicolon - close - 1);
+        std::string arraySuffix;
+        int angleDepth = 0;
+        for (size_t i = 0; i < declaration.size(); ++i) {
+            char c = declaration[i];
+            if (c == '<') ++angleDepth;
+            else if (c == '>') --angleDepth;
+            bool bitfield = c == ':' && (i + 1 >= declaration.size() || declaration[i + 1] != ':') &&
+                            (i == 0 || declaration[i - 1] != ':');
+            if (angleDepth == 0 && (c == '=' || c == '{' || c == '[' || bitfield)) {
+                if (c == '[') {
+                    size_t closeBracket = declaration.find(']', i);
+                    if (closeBracket != std::string_view::npos) {
+                        arraySuffix = normalizePropertyType(declaration.substr(i, closeBracket - i + 1));
+                    }
+                }
+                declaration = declaration.substr(0, i);
+                break;
+            }
+        }
+        
+        size_t nameEnd = declaration.find_last_not_of(" \t\r\n");
+        if (nameEnd == std::string_view::npos) continue;
+        ++nameEnd;
+        size_t nameBegin = nameEnd;
+        while (nameBegin > 0 && isIdentifierChar(declaration[nameBegin - 1])) --nameBegin;
+        if (nameBegin == nameEnd || nameBegin == 0) continue;
+        
+        std::string type = normalizePropertyType(declaration.substr(0, nameBegin)) + arraySuffix;
+        if (type.empty()) continue;
+        
+        uint32_t flags = SymbolFlags::None;
+        for (auto specifier : topLevelSpecifiers(body.substr(open + 1, close - open - 1))) {
+            flags |= PropertyFlags::fromSpecifier(specifier);
+        }
+        
+        const size_t nameOffset = close + 1 + nameBegin;
+        line += static_cast<int>(std::count(body.begin() + lineCursor, body.begin() + nameOffset, '\n'));
+        lineCursor = nameOffset;
+        
+        SymbolRecord record;
+        record.name = InternedString(declaration.substr(nameBegin, nameEnd - nameBegin)).id();
+        record.kind = SymbolKind::Property;
+        record.owner = classId;
+        record.file = fileId;
+        record.startLine = line;
+        record.endLine = line;
+        record.flags = flags;
+        record.type = InternedString(type).id();
+        properties.push_back(record);
+    }
+    
+    return properties;
+}
+
+// =============================================================================
+// EngineIndex / EngineIndexRegistry 구현
+// =============================================================================
+
+EngineIndex::EngineIndex(const EngineVersion& version, bool lazyParsing)
+    : version_(version), scanner_(version) {
+    
+    scanner_.setLazyParsing(lazyParsing);
+    scanThread_ = std::thread([this]() {
+        // 이 버전용으로 미리 빌드한 인덱스가 있으면 스캔 대신 적재
+        if (auto prebuilt = PrebuiltEngineIndex::find(version_)) {
+            if (PrebuiltEngineIndex::load(*prebuilt, version_, scanner_)) {
+                loadedPrebuilt_ = true;
+                scanner_.skipScan();
+                scanning_ = false;
+                std::cerr << "📦 Loaded prebuilt engine index " << *prebuilt << std::endl;
+                return;
+            }
+            std::cerr << "⚠️  Prebuilt engine index " << *prebuilt << " is invalid or not for UE "
+                      << version_.toString() << ", scanning instead" << std::endl;
+        }
+        scanner_.scanEngineHeaders();
+        scanning_ = false;
+    });
+}
+
+EngineIndex::~EngineIndex() {
+    scanner_.cancel();
+    waitForIndexing();
+}
+
+void EngineIndex::waitForIndexing() {
+    std::lock_guard<std::mutex> lock(scanThreadMutex_);
+    if (scanThread_.joinable()) {
+        scanThread_.join();
+    }
+}
+
+EngineIndexRegistry& EngineIndexRegistry::instance() {
+    static EngineIndexRegistry registry;
+    return registry;
+}
+
+std::string EngineIndexRegistry::keyFor(const EngineVersion& version) {
+    return version.toString() + '|' + version.installPath;
+}
+
+std::shared_ptr<EngineIndex> EngineIndexRegistry::acquire(const EngineVersion& version) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    auto& slot = indexes_[keyFor(version)];
+    if (auto existing = slot.weak.lock()) {
+        slot.unusedSince.reset();
+        return existing;
+    }
+    
+    auto index = std::make_shared<EngineIndex>(version, lazyParsing_);
+    slot.hold(index, retention_.count() > 0);
+    
+    // 이미 해제된 항목 정리
+    for (auto it = indexes_.begin(); it != indexes_.end(); ) {
+        it = !it->second.retained && it->second.weak.expired() ? indexes_.erase(it) : std::next(it);
+    }
+    
+    return index;
+}
+
+void EngineIndexRegistry::setRetention(std::chrono::steady_clock::duration retention) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    retention_ = retention;
+}
+
+void EngineIndexRegistry::releaseIdle() {
+    std::vector<std::shared_ptr<EngineIndex>> released;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto now = std::chrono::steady_clock::now();
+        for (auto it = indexes_.begin(); it != indexes_.end(); ) {
+            it = it->second.expire(now, retention_, released) ? indexes_.erase(it) : std::next(it);
+        }
+    }
+    for (const auto& index : released) {
+        std::cerr << "🧹 Released idle UE " << index->version().toString() << " index" << std::endl;
+    }
+    // 마지막 참조라면 여기서 (잠금 밖) 해제
+}
+
+bool EngineIndexRegistry::scanning() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::any_of(indexes_.begin(), indexes_.end(), [](const auto& entry) {
+        auto index = entry.second.weak.lock();
+        return index && index->scanning();
+    });
+}
+
+json EngineIndexRegistry::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    json engines = json::array();
+    for (const auto& [key, slot] : indexes_) {
+        if (auto index = slot.weak.lock()) {
+            engines.push_back({
+                {"version", index->version().toString()},
+                {"installPath", index->version().installPath},
+                {"projects", slot.users() - 1},     // 지금 잡은 참조 제외
+                {"symbolTableBytes", index->memoryBytes()},
+                {"lazyClassesPending", index->scanner().pendingClassCount()},
+                {"indexQueue", index->scanner().queueStats()},
+                {"prebuilt", index->loadedPrebuilt()}
+            });
+        }
+    }
+    return engines;
+}
+
+size_t EngineIndexRegistry::memoryBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    size_t bytes = 0;
+    for (const auto& [key, slot] : indexes_) {
+        if (auto index = slot.weak.lock()) {
+            bytes += index->memoryBytes();
+        }
+    }
+    return bytes;
+}
+
+const std::vector<PluginDescriptor>& EngineIndex::enginePlugins() {
+    std::call_once(pluginsDiscovered_, [this]() {
+        if (!version_.installPath.empty()) {
+            enginePlugins_ = PluginCatalog::discover(version_.installPath + "/Engine/Plugins", false);
+        }
+    });
+    return enginePlugins_;
+}
+
+// =============================================================================
+// PrebuiltEngineIndex 구현
+// =============================================================================
+
+namespace {
+
+// 읽기 전용 mmap - 스코프를 벗어나면 해제
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return;
+        
+        struct stat info {};
+        if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* mapped = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped != MAP_FAILED) {
+                data_ = static_cast<const char*>(mapped);
+                size_ = static_cast<size_t>(info.st_size);
+            }
+        }
+        ::close(fd);
+    }
+    ~MappedFile() {
+        if (data_) ::munmap(const_cast<char*>(data_), size_);
+    }
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+size_t alignTo4(size_t bytes) {
+    return (bytes + 3) & ~size_t{3};
+}
+
+} // namespace
+
+std::string PrebuiltEngineIndex::fileNameFor(const EngineVersion& version) {
+    return "EngineIndex-" + version.toString() + ".ueidx";
+}
+
+std::vector<std::string> PrebuiltEngineIndex::searchPaths(const EngineVersion& version) {
+    std::vector<std::string> paths;
+    std::string fileName = fileNameFor(version);
+    
+    if (const char* indexDir = std::getenv("UNREAL_LSP_INDEX_DIR")) {
+        paths.push_back(std::string(indexDir) + "/" + fileName);
+    }
+    if (!version.installPath.empty()) {
+        paths.push_back(version.installPath + "/Engine/Intermediate/UnrealLSP/" + fileName);
+    }
+    if (const char* home = std::getenv("HOME")) {
+#if defined(__APPLE__)
+        paths.push_back(std::string(home) + "/Library/Caches/UnrealLSP/" + fileName);
+#else
+        const char* cacheHome = std::getenv("XDG_CACHE_HOME");
+        paths.push_back((cacheHome ? std::string(cacheHome) : std::string(home) + "/.cache") + "/unreal-lsp/" + fileName);
+#endif
+    }
+    return paths;
+}
+
+std::optional<std::string> PrebuiltEngineIndex::find(const EngineVersion& version) {
+    // 상대 경로를 풀 설치 위치를 모르면 쓸 수 없음
+    if (version.installPath.empty()) return std::nullopt;
+    
+    std::error_code ec;
+    for (const auto& path : searchPaths(version)) {
+        if (fs::is_regular_file(path, ec)) {
+            return path;
+        }
+    }
+    return std::nullopt;
+}
+
+uint32_t PrebuiltEngineIndex::readChangelist(const std::string& installPath) {
+    std::ifstream file(installPath + "/Engine/Build/Build.version");
+    if (!file.is_open()) return 0;
+    
+    try {
+        return json::parse(file).value("Changelist", 0u);
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
+bool PrebuiltEngineIndex::write(const DynamicHeaderScanner& scanner, const EngineVersion& version, const std::string& path) {
+    UNREAL_TRACE_SPAN_DETAIL("writePrebuiltIndex", "indexer", path);
+    auto rows = scanner.records();
+    
+    // 문자열 테이블 (0번은 빈 문자열)
+    std::vector<std::string_view> strings = {std::string_view()};
+    std::unordered_map<std::string_view, uint32_t> stringIndex = {{std::string_view(), 0}};
+    auto indexOf = [&](std::string_view value) {
+        auto [it, inserted] = stringIndex.emplace(value, static_cast<uint32_t>(strings.size()));
+        if (inserted) strings.push_back(value);
+        return it->second;
+    };
+    
+    const std::string enginePrefix = version.installPath + "/";
+    std::vector<uint32_t> names, owners, files, types, flags;
+    std::vector<int32_t> startLines, endLines;
+    std::vector<uint8_t> kinds;
+    for (const auto& row : rows) {
+        std::string_view file = InternedString::fromId(row.file).view();
+        if (!version.installPath.empty() && file.compare(0, enginePrefix.size(), enginePrefix) == 0) {
+            file.remove_prefix(enginePrefix.size());
+        }
+        names.push_back(indexOf(InternedString::fromId(row.name).view()));
+        owners.push_back(indexOf(InternedString::fromId(row.owner).view()));
+        files.push_back(indexOf(file));
+        types.push_back(indexOf(InternedString::fromId(row.type).view()));
+        startLines.push_back(row.startLine);
+        endLines.push_back(row.endLine);
+        flags.push_back(row.flags);
+        kinds.push_back(static_cast<uint8_t>(row.kind));
+    }
+    
+    std::vector<uint32_t> offsets = {0};
+    for (auto value : strings) {
+        offsets.push_back(offsets.back() + static_cast<uint32_t>(value.size()));
+    }
+    
+    Header header {};
+    std::copy(std::begin(Magic), std::end(Magic), header.magic);
+    header.formatVersion = FormatVersion;
+    header.major = version.major;
+    header.minor = version.minor;
+    header.patch = version.patch;
+    header.changelist = readChangelist(version.installPath);
+    header.stringCount = static_cast<uint32_t>(strings.size());
+    header.rowCount = static_cast<uint32_t>(rows.size());
+    header.stringBytes = offsets.back();
+    
+    // 임시 파일에 쓰고 rename - 서버가 반쯤 쓴 파일을 mmap 하지 않도록
+    std::string temporaryPath = path + ".tmp";
+    {
+        std::ofstream out(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) return false;
+        
+        auto writeBytes = [&out](const void* data, size_t size) {
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        };
+        writeBytes(&header, sizeof(header));
+        writeBytes(offsets.data(), offsets.size() * sizeof(uint32_t));
+        for (auto value : strings) {
+            writeBytes(value.data(), value.size());
+        }
+        const char padding[4] = {};
+        writeBytes(padding, alignTo4(header.stringBytes) - header.stringBytes);
+        writeBytes(names.data(), names.size() * sizeof(uint32_t));
+        writeBytes(owners.data(), owners.size() * sizeof(uint32_t));
+        writeBytes(files.data(), files.size() * sizeof(uint32_t));
+        writeBytes(types.data(), types.size() * sizeof(uint32_t));
+        writeBytes(startLines.data(), startLines.size() * sizeof(int32_t));
+        writeBytes(endLines.data(), endLines.size() * sizeof(int32_t));
+        writeBytes(flags.data(), flags.size() * sizeof(uint32_t));
+        writeBytes(kinds.data(), kinds.size());
+        
+        if (!out.good()) return false;
+    }
+    
+    std::error_code ec;
+    fs::rename(temporaryPath, path, ec);
+    return !ec;
+}
+
+bool PrebuiltEngineIndex::load(const std::string& path, const EngineVersion& version, DynamicHeaderScanner& scanner) {
+    UNREAL_TRACE_SPAN_DETAIL("loadPrebuiltIndex", "indexer", path);
+    
+    MappedFile mapped(path);
+    if (!mapped.data() || mapped.size() < sizeof(Header)) return false;
+    
+    Header header;
+    std::memcpy(&header, mapped.data(), sizeof(header));
+    if (!std::equal(std::begin(Magic), std::end(Magic), header.magic) ||
+        header.formatVersion != FormatVersion ||
+        header.major != version.major || header.minor != version.minor || header.patch != version.patch) {
+        return false;
+    }
+    uint32_t localChangelist = readChangelist(version.installPath);
+    if (header.changelist != 0 && localChangelist != 0 && header.changelist != localChangelist) {
+        return false;
+    }
+    
+    // 크기 검증 (잘린 파일, 손상된 오프셋)
+    const uint64_t rows = header.rowCount;
+    const uint64_t offsetsBegin = sizeof(Header);
+    const uint64_t stringsBegin = offsetsBegin + (uint64_t{header.stringCount} + 1) * sizeof(uint32_t);
+    const uint64_t columnsBegin = alignTo4(stringsBegin + header.stringBytes);
+    const uint64_t expectedSize = columnsBegin + rows * (7 * sizeof(uint32_t) + sizeof(uint8_t));
+    if (header.stringCount == 0 || expectedSize != mapped.size()) return false;
+    
+    const char* base = mapped.data();
+    auto column = [&](size_t index) {
+        return reinterpret_cast<const uint32_t*>(base + columnsBegin + index * rows * sizeof(uint32_t));
+    };
+    const auto* offsets = reinterpret_cast<const uint32_t*>(base + offsetsBegin);
+    const uint32_t* names = column(0);
+    const uint32_t* owners = column(1);
+    const uint32_t* files = column(2);
+    const uint32_t* types = column(3);
+    const auto* startLines = reinterpret_cast<const int32_t*>(column(4));
+    const auto* endLines = reinterpret_cast<const int32_t*>(column(5));
+    const uint32_t* flags = column(6);
+    const auto* kinds = reinterpret_cast<const uint8_t*>(column(7));
+    
+    for (uint32_t i = 0; i < header.stringCount; ++i) {
+        if (offsets[i] > offsets[i + 1] || offsets[i + 1] > header.stringBytes) return false;
+    }
+    
+    // 문자열은 처음 쓰일 때 한 번만 인터닝
+    const char* stringData = base + stringsBegin;
+    std::vector<SymbolId> ids(header.stringCount, StringInterner::EmptyId);
+    std::vector<SymbolId> fileIds(header.stringCount, StringInterner::EmptyId);
+    std::vector<bool> resolved(header.stringCount, false), fileResolved(header.stringCount, false);
+    auto text = [&](uint32_t index) {
+        return std::string_view(stringData + offsets[index], offsets[index + 1] - offsets[index]);
+    };
+    auto idOf = [&](uint32_t index) {
+        if (!resolved[index]) {
+            ids[index] = index == 0 ? StringInterner::EmptyId : InternedString(text(index)).id();
+            resolved[index] = true;
+        }
+        return ids[index];
+    };
+    auto fileIdOf = [&](uint32_t index) {
+        if (!fileResolved[index]) {
+            std::string_view file = text(index);
+            fileIds[index] = file.empty() || file.front() == '/'
+                ? idOf(index)
+                : InternedString(version.installPath + "/" + std::string(file)).id();
+            fileResolved[index] = true;
+        }
+        return fileIds[index];
+    };
+    
+    std::vector<SymbolRecord> records;
+    records.reserve(rows);
+    for (uint64_t row = 0; row < rows; ++row) {
+        if (names[row] >= header.stringCount || owners[row] >= header.stringCount ||
+            files[row] >= header.stringCount || types[row] >= header.stringCount || kinds[row] > static_cast<uint8_t>(SymbolKind::Typedef)) {
+            return false;
+        }
+        
+        SymbolRecord record;
+        record.name = idOf(names[row]);
+        record.kind = static_cast<SymbolKind>(kinds[row]);
+        record.owner = idOf(owners[row]);
+        record.file = fileIdOf(files[row]);
+        record.startLine = startLines[row];
+        record.endLine = endLines[row];
+        record.flags = flags[row];
+        record.type = idOf(types[row]);
+        records.push_back(record);
+    }
+    
+    scanner.adoptRecords(records);
+    return true;
+}
+
+// =============================================================================
+// PluginCatalog 구현
+// =============================================================================
+
+std::optional<PluginDescriptor> PluginCatalog::readDescriptor(const fs::path& upluginPath, bool isProjectPlugin) {
+    std::ifstream file(upluginPath);
+    if (!file.is_open()) return std::nullopt;
+    
+    try {
+        json descriptor = json::parse(file);
+        
+        PluginDescriptor plugin;
+        plugin.name = upluginPath.stem().string();
+        plugin.descriptorPath = upluginPath.string();
+        plugin.rootPath = upluginPath.parent_path().string();
+        plugin.isProjectPlugin = isProjectPlugin;
+        plugin.versionName = descriptor.value("VersionName", std::to_string(descriptor.value("Version", 0)));
+        
+        for (const auto& dependency : descriptor.value("Plugins", json::array())) {
+            if (dependency.value("Enabled", false)) {
+                plugin.dependencies.push_back(dependency.value("Name", ""));
+            }
+        }
+        return plugin;
+    } catch (const std::exception&) {
+        // 잘못된 .uplugin은 건너뜀
+        return std::nullopt;
+    }
+}
+
+std::vector<PluginDescriptor> PluginCatalog::discover(const std::string& pluginsRoot, bool isProjectPlugin) {
+    UNREAL_TRACE_SPAN_DETAIL("discoverPlugins", "indexer", pluginsRoot);
+    std::vector<PluginDescriptor> plugins;
+    
+    std::error_code ec;
+    if (!fs::is_directory(pluginsRoot, ec)) return plugins;
+    
+    std::vector<fs::path> pending = {pluginsRoot};
+    while (!pending.empty()) {
+        fs::path directory = std::move(pending.back());
+        pending.pop_back();
+        
+        std::vector<fs::path> children;
+        bool foundPlugin = false;
+        for (const auto& entry : fs::directory_iterator(directory, ec)) {
+            if (entry.is_regular_file(ec) && entry.path().extension() == ".uplugin") {
+                if (auto plugin = readDescriptor(entry.path(), isProjectPlugin)) {
+                    plugins.push_back(std::move(*plugin));
+                }
+                foundPlugin = true;
+            } else if (entry.is_directory(ec)) {
+                children.push_back(entry.path());
+            }
+        }
+        
+        // 플러그인 폴더 안(Source, Content, Binaries 등)은 더 볼 필요 없음
+        if (!foundPlugin) {
+            pending.insert(pending.end(), children.begin(), children.end());
+        }
+    }
+    
+    return plugins;
+}
+
+std::vector<PluginDescriptor> PluginCatalog::resolveEnabled(const std::string& projectPath,
+                                                            const std::vector<PluginDescriptor>& enginePlugins) {
+    std::unordered_map<std::string, bool> projectSettings;     // .uproject "Plugins"의 Enabled 값
+    try {
+        for (const auto& entry : fs::directory_iterator(projectPath)) {
+            if (entry.path().extension() != ".uproject") continue;
+            
+            std::ifstream file(entry.path());
+            json project = json::parse(file);
+            for (const auto& plugin : project.value("Plugins", json::array())) {
+                projectSettings[plugin.value("Name", "")] = plugin.value("Enabled", false);
+            }
+            break;
+        }
+    } catch (const std::exception&) {
+        // .uproject를 읽지 못하면 프로젝트 플러그인만 사용
+    }
+    
+    // 같은 이름이면 프로젝트 플러그인이 엔진 플러그인을 가림
+    std::unordered_map<std::string, PluginDescriptor> available;
+    for (const auto& plugin : enginePlugins) {
+        available[plugin.name] = plugin;
+    }
+    std::vector<std::string> pending;
+    for (auto& plugin : discover(projectPath + "/Plugins", true)) {
+        auto setting = projectSettings.find(plugin.name);
+        if (setting == projectSettings.end() || setting->second) {
+            pending.push_back(plugin.name);
+        }
+        available[plugin.name] = std::move(plugin);
+    }
+    for (const auto& [name, enabled] : projectSettings) {
+        if (enabled) pending.push_back(name);
+    }
+    
+    // 활성 플러그인이 의존하는 플러그인도 활성
+    std::vector<PluginDescriptor> enabled;
+    std::unordered_set<std::string> visited;
+    while (!pending.empty()) {
+        std::string name = std::move(pending.back());
+        pending.pop_back();
+        if (!visited.insert(name).second) continue;
+        
+        auto it = available.find(name);
+        if (it == available.end()) continue;
+        
+        enabled.push_back(it->second);
+        for (const auto& dependency : it->second.dependencies) {
+            pending.push_back(dependency);
+        }
+    }
+    
+    return enabled;
+}
+
+// =============================================================================
+// PluginIndexShard / PluginShardRegistry 구현
+// =============================================================================
+
+PluginIndexShard::PluginIndexShard(PluginDescriptor descriptor, std::string cacheKey)
+    : descriptor_(std::move(descriptor)),
+      cacheKey_(std::move(cacheKey)),
+      scanner_(EngineVersion{0, 0, 0, "", descriptor_.rootPath}) {}
+
+void PluginIndexShard::build() {
+    UNREAL_TRACE_SPAN_DETAIL("buildPluginShard", "indexer", descriptor_.name);
+    scanner_.scanDirectories({descriptor_.rootPath + "/Source"});
+}
+
+PluginShardRegistry& PluginShardRegistry::instance() {
+    static PluginShardRegistry registry;
+    return registry;
+}
+
+std::string PluginShardRegistry::cacheKeyFor(const PluginDescriptor& descriptor) {
+    // FNV-1a
+    uint64_t hash = 1469598103934665603ULL;
+    auto mix = [&hash](const void* data, size_t size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ULL;
+        }
+    };
+    
+    std::vector<std::pair<std::string, std::pair<uintmax_t, int64_t>>> stamps;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(descriptor.rootPath + "/Source", ec), end; !ec && it != end; it.increment(ec)) {
+        if (!it->is_regular_file(ec) || it->path().extension() != ".h") continue;
+        auto size = it->file_size(ec);
+        auto modified = static_cast<int64_t>(it->last_write_time(ec).time_since_epoch().count());
+        stamps.push_back({it->path().string(), {size, modified}});
+    }
+    
+    // 디렉토리 순회 순서에 의존하지 않도록 정렬
+    std::sort(stamps.begin(), stamps.end());
+    for (const auto& [path, stamp] : stamps) {
+        mix(path.data(), path.size());
+        mix(&stamp.first, sizeof(stamp.first));
+        mix(&stamp.second, sizeof(stamp.second));
+    }
+    
+    std::ostringstream key;
+    key << descriptor.versionName << '|' << std::hex << hash;
+    return key.str();
+}
+
+std::shared_ptr<PluginIndexShard> PluginShardRegistry::acquire(const PluginDescriptor& descriptor) {
+    std::string cacheKey = cacheKeyFor(descriptor);
+    
+    auto findCurrent = [&]() -> std::shared_ptr<PluginIndexShard> {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = shards_.find(descriptor.descriptorPath);
+        if (it == shards_.end()) return nullptr;
+        auto shard = it->second.lock();
+        return shard && shard->cacheKey() == cacheKey ? shard : nullptr;
+    };
+    
+    if (auto shard = findCurrent()) {
+        return shard;
+    }
+    
+    std::lock_guard<std::mutex> buildLock(buildMutex_);
+    if (auto shard = findCurrent()) {
+        return shard;       // 기다리는 동안 다른 프로젝트가 빌드함
+    }
+    
+    auto shard = std::make_shared<PluginIndexShard>(descriptor, cacheKey);
+    shard->scanner().setLazyParsing(EngineIndexRegistry::instance().lazyParsing());
+    shard->build();
+    
+    std::lock_guard<std::mutex> lock(mutex_);
+    shards_[descriptor.descriptorPath] = shard;
+    for (auto it = shards_.begin(); it != shards_.end(); ) {
+        it = it->second.expired() ? shards_.erase(it) : std::next(it);
+    }
+    return shard;
+}
+
+json PluginShardRegistry::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    json shards = json::array();
+    for (const auto& [path, weak] : shards_) {
+        if (auto shard = weak.lock()) {
+            shards.push_back({
+                {"plugin", shard->descriptor().name},
+                {"version", shard->descriptor().versionName},
+                {"projects", shard.use_count() - 1},
+                {"symbolTableBytes", shard->memoryBytes()}
+            });
+        }
+    }
+    return shards;
+}
+
+size_t PluginShardRegistry::memoryBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    
+    size_t bytes = 0;
+    for (const auto& [path, weak] : shards_) {
+        if (auto shard = weak.lock()) {
+            bytes += shard->memoryBytes();
+        }
+    }
+    return bytes;
+}
+
+// =============================================================================
+// IncludeGraph 구현
+// =============================================================================
+
+namespace {
+
+// [0, count) 를 workers 개 스레드가 나눠서 (호출한 스레드도 하나로 참여)
+void parallelFor(size_t count, size_t workers, const std::function<void(size_t)>& body) {
+    std::atomic<size_t> next{0};
+    auto run = [&]() {
+        for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < count; ) body(i);
+    };
+    std::vector<std::thread> threads;
+    for (size_t w = 1; w < std::min(workers, count); ++w) threads.emplace_back(run);
+    run();
+    for (auto& thread : threads) thread.join();
+}
+
+} // namespace
+
+void IncludeGraph::build(const std::vector<std::string>& files) {
+    UNREAL_TRACE_SPAN("buildIncludeGraph", "indexer", 0);
+    auto started = std::chrono::steady_clock::now();
+    
+    std::vector<std::string> sorted = files;
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    
+    files_.clear();
+    bytes_.clear();
+    lines_.clear();
+    nodes_.clear();
+    byFileName_.clear();
+    for (const auto& file : sorted) {
+        const SymbolId id = InternedString(file).id();
+        const auto node = static_cast<NodeId>(files_.size());
+        files_.push_back(id);
+        nodes_.emplace(id, node);
+        byFileName_.emplace(fs::path(file).filename().string(), node);
+    }
+    
+    // 바뀐 파일만 다시 읽음 (없어진 파일의 결과는 버림)
+    std::unordered_map<SymbolId, ParsedFile> parsed;
+    parsed.reserve(files_.size());
+    for (const auto& file : sorted) {
+        const SymbolId id = InternedString(file).id();
+        std::error_code ec;
+        auto modified = fs::last_write_time(file, ec);
+        auto bytes = ec ? 0 : fs::file_size(file, ec);
+        
+        auto previous = parsed_.find(id);
+        if (!ec && previous != parsed_.end() && previous->second.modified == modified && previous->second.bytes == bytes) {
+            parsed.emplace(id, std::move(previous->second));
+            continue;
+        }
+        
+        ParsedFile entry;
+        entry.modified = modified;
+        entry.bytes = bytes;
+        std::ifstream in(file);
+        if (in.is_open()) {
+            std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+            entry.bytes = content.size();
+            entry.lines = static_cast<uint32_t>(std::count(content.begin(), content.end(), '\n'));
+            entry.includes = IndexScheduler::parseIncludes(content);
+        }
+        parsed.emplace(id, std::move(entry));
+    }
+    parsed_ = std::move(parsed);
+    
+    std::vector<std::pair<NodeId, NodeId>> edges;
+    bytes_.resize(files_.size());
+    lines_.resize(files_.size());
+    unresolved_ = 0;
+    for (NodeId node = 0; node < files_.size(); ++node) {
+        const auto& entry = parsed_[files_[node]];
+        bytes_[node] = static_cast<uint32_t>(std::min<uintmax_t>(entry.bytes, UINT32_MAX));
+        lines_[node] = entry.lines;
+        for (const auto& include : entry.includes) {
+            auto target = this->resolve(node, include);
+            if (target && *target != node) edges.emplace_back(node, *target);
+            else if (!target) ++unresolved_;
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    
+    // CSR: offsets[i]..offsets[i + 1] 이 i 의 간선
+    auto toCsr = [this](const std::vector<std::pair<NodeId, NodeId>>& pairs,
+                        std::vector<uint32_t>& offsets, std::vector<uint32_t>& targets) {
+        offsets.assign(files_.size() + 1, 0);
+        for (const auto& [from, to] : pairs) ++offsets[from + 1];
+        for (size_t i = 1; i < offsets.size(); ++i) offsets[i] += offsets[i - 1];
+        targets.resize(pairs.size());
+        std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+        for (const auto& [from, to] : pairs) targets[cursor[from]++] = to;
+        offsets.shrink_to_fit();
+        targets.shrink_to_fit();
+    };
+    toCsr(edges, offsets_, edges_);
+    for (auto& [from, to] : edges) std::swap(from, to);
+    std::sort(edges.begin(), edges.end());
+    toCsr(edges, reverseOffsets_, reverseEdges_);
+    
+    buildSeconds_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+}
+
+std::optional<IncludeGraph::NodeId> IncludeGraph::find(const std::string& filePath) const {
+    auto id = StringInterner::instance().find(filePath);
+    if (!id) return std::nullopt;
+    auto it = nodes_.find(*id);
+    if (it == nodes_.end()) return std::nullopt;
+    return it->second;
+}
+
+// 포함하는 파일 기준 상대 경로 -> 같은 꼬리 경로를 가진 파일 (경로 정렬 순 첫 번째)
+std::optional<IncludeGraph::NodeId> IncludeGraph::resolve(NodeId from, const std::string& include) const {
+    fs::path relative = (fs::path(std::string(path(from))).parent_path() / include).lexically_normal();
+    if (auto id = StringInterner::instance().find(relative.string())) {
+        if (auto it = nodes_.find(*id); it != nodes_.end()) return it->second;
+    }
+    
+    size_t slash = include.rfind('/');
+    auto [begin, end] = byFileName_.equal_range(slash == std::string::npos ? include : include.substr(slash + 1));
+    std::optional<NodeId> best;
+    for (auto it = begin; it != end; ++it) {
+        std::string_view candidate = path(it->second);
+        if (candidate.size() > include.size() &&
+            candidate.compare(candidate.size() - include.size(), include.size(), include) == 0 &&
+            candidate[candidate.size() - include.size() - 1] == '/' &&
+            (!best || it->second < *best)) {
+            best = it->second;
+        }
+    }
+    return best;
+}
+
+std::vector<IncludeGraph::NodeId> IncludeGraph::directIncludes(NodeId node) const {
+    return std::vector<NodeId>(edges_.begin() + offsets_[node], edges_.begin() + offsets_[node + 1]);
+}
+
+std::vector<IncludeGraph::NodeId> IncludeGraph::directIncluders(NodeId node) const {
+    return std::vector<NodeId>(reverseEdges_.begin() + reverseOffsets_[node],
+                               reverseEdges_.begin() + reverseOffsets_[node + 1]);
+}
+
+IncludeGraph::Closure IncludeGraph::transitiveIncludes(NodeId node) const {
+    return reach(node, offsets_, edges_);
+}
+
+IncludeGraph::Closure IncludeGraph::dependents(NodeId node) const {
+    return reach(node, reverseOffsets_, reverseEdges_);
+}
+
+IncludeGraph::Closure IncludeGraph::reach(NodeId start, const std::vector<uint32_t>& offsets,
+                                          const std::vector<uint32_t>& edges) const {
+    Closure closure;
+    std::vector<uint64_t> visited((files_.size() + 63) / 64, 0);
+    visited[start / 64] |= uint64_t{1} << (start % 64);
+    
+    std::vector<NodeId> frontier = {start};
+    for (size_t head = 0; head < frontier.size(); ++head) {
+        const NodeId node = frontier[head];
+        for (uint32_t e = offsets[node]; e < offsets[node + 1]; ++e) {
+            const NodeId next = edges[e];
+            uint64_t& word = visited[next / 64];
+            const uint64_t bit = uint64_t{1} << (next % 64);
+            if (word & bit) continue;
+            word |= bit;
+            frontier.push_back(next);
+            closure.nodes.push_back(next);
+            closure.bytes += bytes_[next];
+            closure.lines += lines_[next];
+        }
+    }
+    return closure;
+}
+
+std::vector<IncludeGraph::ClosureCost> IncludeGraph::closureCosts(const std::vector<NodeId>& roots, size_t workers,
+                                                                  const ReachVisitor& visit) const {
+    std::vector<ClosureCost> costs(roots.size());
+    
+    // roots 에서 도달하는 부분 그래프 (지역 번호)
+    std::vector<int32_t> local(files_.size(), -1);
+    std::vector<NodeId> members;
+    for (auto root : roots) {
+        if (local[root] >= 0) continue;
+        local[root] = static_cast<int32_t>(members.size());
+        members.push_back(root);
+        for (size_t head = members.size() - 1; head < members.size(); ++head) {
+            for (uint32_t e = offsets_[members[head]]; e < offsets_[members[head] + 1]; ++e) {
+                if (local[edges_[e]] >= 0) continue;
+                local[edges_[e]] = static_cast<int32_t>(members.size());
+                members.push_back(edges_[e]);
+            }
+        }
+    }
+    
+    const size_t count = members.size();
+    const size_t words = (count + 63) / 64;
+    if (count * words * sizeof(uint64_t) > MaxClosureMatrixBytes) {
+        // 행렬이 너무 크면 루트마다 BFS
+        parallelFor(roots.size(), workers, [&](size_t i) {
+            auto closure = transitiveIncludes(roots[i]);
+            costs[i] = {closure.bytes, closure.lines, static_cast<uint32_t>(closure.nodes.size())};
+        });
+        if (visit) {
+            for (size_t i = 0; i < roots.size(); ++i) {
+                for (auto node : transitiveIncludes(roots[i]).nodes) visit(i, node);
+            }
+        }
+        return costs;
+    }
+    
+    // Tarjan SCC (반복형) - 컴포넌트 번호는 역위상 순서 (자식이 먼저)
+    std::vector<int32_t> order(count, -1), low(count, 0), component(count, -1);
+    std::vector<uint32_t> stack;
+    std::vector<std::pair<uint32_t, uint32_t>> calls;       // (지역 노드, 다음 간선)
+    int32_t counter = 0;
+    uint32_t components = 0;
+    for (uint32_t start = 0; start < count; ++start) {
+        if (order[start] >= 0) continue;
+        auto enter = [&](uint32_t v) {
+            order[v] = low[v] = counter++;
+            stack.push_back(v);
+            calls.emplace_back(v, offsets_[members[v]]);
+        };
+        enter(start);
+        while (!calls.empty()) {
+            const uint32_t v = calls.back().first;
+            const uint32_t e = calls.back().second;
+            if (e < offsets_[members[v] + 1]) {
+                ++calls.back().second;
+                const auto w = static_cast<uint32_t>(local[edges_[e]]);
+                if (order[w] < 0) enter(w);
+                else if (component[w] < 0) low[v] = std::min(low[v], order[w]);
+                continue;
+            }
+            if (low[v] == order[v]) {
+                uint32_t w;
+                do {
+                    w = stack.back();
+                    stack.pop_back();
+                    component[w] = static_cast<int32_t>(components);
+                } while (w != v);
+                ++components;
+            }
+            calls.pop_back();
+            if (!calls.empty()) low[calls.back().first] = std::min(low[calls.back().first], low[v]);
+        }
+    }
+    
+    // DP: 컴포넌트 닫힘 = 자기 멤버 | 자식 컴포넌트 닫힘
+    std::vector<std::vector<uint32_t>> componentMembers(components);
+    for (uint32_t v = 0; v < count; ++v) componentMembers[component[v]].push_back(v);
+    std::vector<uint64_t> bits(components * words, 0);
+    for (uint32_t c = 0; c < components; ++c) {
+        uint64_t* row = bits.data() + size_t{c} * words;
+        for (auto v : componentMembers[c]) {
+            row[v / 64] |= uint64_t{1} << (v % 64);
+            for (uint32_t e = offsets_[members[v]]; e < offsets_[members[v] + 1]; ++e) {
+                const auto child = static_cast<uint32_t>(component[local[edges_[e]]]);
+                if (child == c) continue;
+                const uint64_t* childRow = bits.data() + size_t{child} * words;
+                for (size_t k = 0; k < words; ++k) row[k] |= childRow[k];
+            }
+        }
+    }
+    
+    auto forEachBit = [&](uint32_t c, auto&& fn) {
+        const uint64_t* row = bits.data() + size_t{c} * words;
+        for (size_t k = 0; k < words; ++k) {
+            for (uint64_t word = row[k]; word; word &= word - 1) {
+                fn(members[k * 64 + static_cast<size_t>(__builtin_ctzll(word))]);
+            }
+        }
+    };
+    
+    // 컴포넌트별 합 (루트가 속한 컴포넌트만, 병렬)
+    std::vector<uint32_t> needed;
+    std::vector<ClosureCost> componentCost(components);
+    std::vector<bool> isNeeded(components, false);
+    for (auto root : roots) {
+        auto c = static_cast<uint32_t>(component[local[root]]);
+        if (!isNeeded[c]) {
+            isNeeded[c] = true;
+            needed.push_back(c);
+        }
+    }
+    parallelFor(needed.size(), workers, [&](size_t i) {
+        auto& cost = componentCost[needed[i]];
+        forEachBit(needed[i], [&](NodeId node) {
+            cost.bytes += bytes_[node];
+            cost.lines += lines_[node];
+            ++cost.includes;
+        });
+    });
+    
+    for (size_t i = 0; i < roots.size(); ++i) {
+        const auto c = static_cast<uint32_t>(component[local[roots[i]]]);
+        costs[i] = {componentCost[c].bytes - bytes_[roots[i]], componentCost[c].lines - lines_[roots[i]],
+                    componentCost[c].includes - 1};
+        if (visit) {
+            forEachBit(c, [&](NodeId node) {
+                if (node != roots[i]) visit(i, node);
+            });
+        }
+    }
+    return costs;
+}
+
+json IncludeGraph::stats() const {
+    return {
+        {"files", files_.size()},
+        {"edges", edges_.size()},
+        {"unresolvedIncludes", unresolved_},
+        {"bytes", memoryBytes()},
+        {"buildSeconds", buildSeconds_}
+    };
+}
+
+size_t IncludeGraph::memoryBytes() const {
+    return (files_.capacity() + bytes_.capacity() + lines_.capacity() + offsets_.capacity() + edges_.capacity() +
+            reverseOffsets_.capacity() + reverseEdges_.capacity()) * sizeof(uint32_t) +
+           nodes_.size() * (sizeof(SymbolId) + sizeof(NodeId) + sizeof(void*)) +
+           byFileName_.size() * (sizeof(std::string) + sizeof(NodeId) + sizeof(void*));
+}
+
+// =============================================================================
+// IncludeUsage 구현
+// =============================================================================
+
+namespace {
+
+// 템플릿 인자가 불완전한 타입이어도 되는 래퍼 (전방 선언으로 충분)
+bool isIndirectWrapper(std::string_view name) {
+    return name == "TObjectPtr" || name == "TWeakObjectPtr" || name == "TSoftObjectPtr" ||
+           name == "TSubclassOf" || name == "TSoftClassPtr" || name == "TLazyObjectPtr";
+}
+
+// ENGINE_API 같은 내보내기 매크로 - class 키워드와 이름 사이에 올 수 있음
+bool isExportMacro(std::string_view word) {
+    return (word.size() > 4 && word.substr(word.size() - 4) == "_API") || word == "DLLEXPORT" || word == "DLLIMPORT";
+}
+
+} // namespace
+
+IncludeUsage IncludeUsage::analyze(std::string_view content) {
+    IncludeUsage usage;
+    const size_t size = content.size();
+    auto skipSpaces = [&](size_t pos) {
+        while (pos < size && std::isspace(static_cast<unsigned char>(content[pos]))) ++pos;
+        return pos;
+    };
+    
+    int line = 0;
+    bool lineStart = true;
+    std::string_view lastWord;      // 바로 앞 토큰이 식별자면 그 이름
+    std::string_view wrapper;       // 바로 앞 '<' 를 연 템플릿 이름
+    char lastSymbol = 0;            // 바로 앞 토큰이 구두점이면 그 문자
+    
+    // 이 파일이 선언하는 이름 (#define, class/struct/enum/union, typedef/using, DECLARE_*, 전역 함수)
+    std::vector<bool> namespaceBraces;      // 열린 '{' 마다 namespace/extern 블록인지
+    int depth = 0;                          // namespace/extern 이 아닌 '{' 깊이
+    bool namespaceHead = false;             // 'namespace'/'extern' 뒤 '{' 나 ';' 전까지
+    bool typeHead = false;                  // 'class'/'struct'/'enum'/'union' 바로 뒤
+    bool defineHead = false;                // '#define' 바로 뒤
+    bool declareHead = false;               // DECLARE_*( 바로 뒤
+    bool inTypedef = false;
+    std::string_view typedefName;
+    auto declare = [&](std::string_view name) { usage.declares.emplace_back(name); };
+    
+    for (size_t i = 0; i < size; ) {
+        const char c = content[i];
+        if (c == '\n') {
+            ++line;
+            lineStart = true;
+            defineHead = false;
+            ++i;
+            continue;
+        }
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            ++i;
+            continue;
+        }
+        
+        // 주석, 문자열/문자 리터럴
+        if (c == '/' && i + 1 < size && content[i + 1] == '/') {
+            i = std::min(content.find('\n', i), size);
+            continue;
+        }
+        if (c == '/' && i + 1 < size && content[i + 1] == '*') {
+            size_t end = content.find("*/", i + 2);
+            end = end == std::string_view::npos ? size : end + 2;
+            line += static_cast<int>(std::count(content.begin() + i, content.begin() + end, '\n'));
+            i = end;
+            continue;
+        }
+        if (c == '"' || c == '\'') {
+            size_t end = i + 1;
+            while (end < size && content[end] != c && content[end] != '\n') {
+                end += content[end] == '\\' ? 2 : 1;
+            }
+            i = std::min(end + 1, size);
+            lastWord = {};
+            lastSymbol = c;
+            continue;
+        }
+        
+        // #include 줄은 기록만 하고 건너뜀 (다른 지시문은 매크로 본문의 사용을 보려고 계속 읽음)
+        if (lineStart && c == '#') {
+            size_t end = std::min(content.find('\n', i), size);
+            auto includes = IndexScheduler::parseIncludes(content.substr(i, end - i));
+            if (!includes.empty()) {
+                usage.includes.push_back({line, std::move(includes.front())});
+                i = end;
+                continue;
+            }
+        }
+        lineStart = false;
+        
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            size_t end = i;
+            while (end < size && isIdentifierChar(content[end])) ++end;
+            std::string_view word = content.substr(i, end - i);
+            size_t next = skipSpaces(end);
+            char following = next < size ? content[next] : 0;
+            
+            bool indirect = following == '*' || following == '&' ||
+                            (lastSymbol == '<' && following == '>' && isIndirectWrapper(wrapper)) ||
+                            ((lastWord == "class" || lastWord == "struct") && following == ';');
+            auto [it, inserted] = usage.identifiers.emplace(std::string(word), !indirect);
+            if (!inserted && !indirect) it->second = true;
+            
+            if (defineHead || declareHead) {
+                declare(word);
+                defineHead = declareHead = false;
+            } else if (typeHead && word != "class" && word != "struct" && !isExportMacro(word) && following != '(') {
+                declare(word);
+                typeHead = false;
+            } else if (word == "define" && lastSymbol == '#') {
+                defineHead = true;
+            } else if (word == "class" || word == "struct" || word == "enum" || word == "union") {
+                typeHead = true;
+            } else if (word == "namespace" || word == "extern") {
+                namespaceHead = true;
+            } else if (word == "typedef") {
+                inTypedef = true;
+            } else if (lastWord == "using" && following == '=') {
+                declare(word);
+            } else if (following == '(' && word.find("DECLARE_") != std::string_view::npos) {
+                declareHead = true;         // DECLARE_DELEGATE_OneParam(FOnFire, ...) 는 FOnFire 를 선언
+            } else if (following == '(' && depth == 0 && !lastWord.empty() && lastWord != "return") {
+                declare(word);              // 반환 타입 뒤 이름 - 전역 함수
+            } else if (following == '(' && depth == 0 && (lastSymbol == '*' || lastSymbol == '&' || lastSymbol == '>')) {
+                declare(word);
+            }
+            if (inTypedef) typedefName = word;
+            
+            lastWord = word;
+            lastSymbol = 0;
+            i = end;
+            continue;
+        }
+        if (std::isdigit(static_cast<unsigned char>(c))) {
+            while (i < size && (isIdentifierChar(content[i]) || content[i] == '.')) ++i;
+            lastWord = {};
+            lastSymbol = 0;
+            continue;
+        }
+        
+        if (c == '<') wrapper = lastWord;
+        if (c != '(') declareHead = false;
+        typeHead = false;
+        if (c == '{') {
+            namespaceBraces.push_back(namespaceHead);
+            if (!namespaceHead) ++depth;
+            namespaceHead = false;
+        } else if (c == '}' && !namespaceBraces.empty()) {
+            if (!namespaceBraces.back()) --depth;
+            namespaceBraces.pop_back();
+        } else if (c == ';') {
+            namespaceHead = false;
+            if (inTypedef && !typedefName.empty()) declare(typedefName);
+            inTypedef = false;
+            typedefName = {};
+        }
+        lastWord = {};
+        lastSymbol = c;
+        ++i;
+    }
+    
+    std::sort(usage.declares.begin(), usage.declares.end());
+    usage.declares.erase(std::unique(usage.declares.begin(), usage.declares.end()), usage.declares.end());
+    return usage;
+}
+
+size_t IncludeUsage::memoryBytes() const {
+    size_t bytes = sizeof(IncludeUsage);
+    for (const auto& include : includes) bytes += sizeof(Include) + include.path.capacity();
+    for (const auto& [name, complete] : identifiers) bytes += sizeof(std::string) + name.capacity() + 2 * sizeof(void*);
+    for (const auto& name : declares) bytes += sizeof(std::string) + name.capacity();
+    return bytes;
+}
+
+// =============================================================================
+// CrossReferenceIndex 구현
+// =============================================================================
+
+namespace {
+
+// 주석, 문자열/문자 리터럴, #include 줄을 건너뛰며 식별자마다 fn(word, line, lineStart, offset)
+template <typename Fn>
+void forEachIdentifier(std::string_view content, Fn&& fn) {
+    const size_t size = content.size();
+    int line = 0;
+    size_t lineStart = 0;
+    bool firstToken = true;
+    for (size_t i = 0; i < size; ) {
+        const char c = content[i];
+        if (c == '\n') {
+            ++line;
+            lineStart = ++i;
+            firstToken = true;
+            continue;
+        }
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            ++i;
+            continue;
+        }
+        if (c == '/' && i + 1 < size && content[i + 1] == '/') {
+            i = std::min(content.find('\n', i), size);
+            continue;
+        }
+        if (c == '/' && i + 1 < size && content[i + 1] == '*') {
+            size_t end = content.find("*/", i + 2);
+            end = end == std::string_view::npos ? size : end + 2;
+            for (size_t k = i; k < end; ++k) {
+                if (content[k] == '\n') {
+                    ++line;
+                    lineStart = k + 1;
+                }
+            }
+            i = end;
+            continue;
+        }
+        if (c == '"' || c == '\'') {
+            size_t end = i + 1;
+            while (end < size && content[end] != c && content[end] != '\n') {
+                end += content[end] == '\\' ? 2 : 1;
+            }
+            i = std::min(end + 1, size);
+            firstToken = false;
+            continue;
+        }
+        if (firstToken && c == '#') {
+            size_t end = std::min(content.find('\n', i), size);
+            if (!IndexScheduler::parseIncludes(content.substr(i, end - i)).empty()) {
+                i = end;
+                continue;
+            }
+        }
+        firstToken = false;
+        
+        if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            size_t end = i;
+            while (end < size && isIdentifierChar(content[end])) ++end;
+            fn(content.substr(i, end - i), line, lineStart, i);
+            i = end;
+            continue;
+        }
+        if (std::isdigit(static_cast<unsigned char>(c))) {
+            while (i < size && (isIdentifierChar(content[i]) || content[i] == '.')) ++i;
+            continue;
+        }
+        ++i;
+    }
+}
+
+// 줄 안의 바이트 위치 -> LSP 의 UTF-16 코드 유닛 위치
+int utf16Column(std::string_view content, size_t lineStart, size_t offset) {
+    int units = 0;
+    for (size_t k = lineStart; k < offset; ++k) {
+        const auto byte = static_cast<unsigned char>(content[k]);
+        if ((byte & 0xC0) != 0x80) units += byte >= 0xF0 ? 2 : 1;
+    }
+    return units;
+}
+
+} // namespace
+
+void CrossReferenceIndex::refresh(const std::vector<std::string>& files,
+                                  const std::unordered_map<std::string, std::string>& openDocuments, size_t workers) {
+    UNREAL_TRACE_SPAN("refreshCrossReferences", "indexer", 0);
+    
+    // 바뀐 파일 고르기 (읽기 잠금)
+    std::vector<size_t> stale;
+    std::vector<int64_t> modified(files.size(), 0);
+    std::vector<uint64_t> hashes(files.size(), 0);
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        for (size_t i = 0; i < files.size(); ++i) {
+            auto open = openDocuments.find(files[i]);
+            if (open != openDocuments.end()) {
+                hashes[i] = ParsedHeaderCache::contentHash(open->second);
+            } else {
+                std::error_code ec;
+                modified[i] = fs::last_write_time(files[i], ec).time_since_epoch().count();
+            }
+            auto it = files_.find(files[i]);
+            if (it == files_.end() || it->second.modified != modified[i] || it->second.contentHash != hashes[i]) {
+                stale.push_back(i);
+            }
+        }
+    }
+    
+    std::vector<FileEntry> entries(stale.size());
+    parallelFor(stale.size(), workers, [&](size_t k) {
+        const size_t i = stale[k];
+        std::string content;
+        auto open = openDocuments.find(files[i]);
+        if (open != openDocuments.end()) {
+            content = open->second;
+        } else {
+            std::ifstream in(files[i]);
+            content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        
+        auto& entry = entries[k];
+        entry.modified = modified[i];
+        entry.contentHash = hashes[i];
+        forEachIdentifier(content, [&](std::string_view word, int, size_t, size_t) {
+            entry.identifiers.push_back(InternedString(word).id());
+        });
+        std::sort(entry.identifiers.begin(), entry.identifiers.end());
+        entry.identifiers.erase(std::unique(entry.identifiers.begin(), entry.identifiers.end()), entry.identifiers.end());
+        entry.identifiers.shrink_to_fit();
+    });
+    
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    for (size_t k = 0; k < stale.size(); ++k) files_[files[stale[k]]] = std::move(entries[k]);
+    rescans_ += stale.size();
+    if (files_.size() > files.size()) {
+        std::unordered_set<std::string_view> listed(files.begin(), files.end());
+        for (auto it = files_.begin(); it != files_.end(); ) {
+            it = listed.count(it->first) ? std::next(it) : files_.erase(it);
+        }
+    }
+}
+
+std::vector<std::string> CrossReferenceIndex::filesMentioning(const std::vector<SymbolId>& names) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<std::string> files;
+    for (const auto& [path, entry] : files_) {
+        for (auto name : names) {
+            if (std::binary_search(entry.identifiers.begin(), entry.identifiers.end(), name)) {
+                files.push_back(path);
+                break;
+            }
+        }
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+std::vector<CrossReferenceIndex::Occurrence> CrossReferenceIndex::occurrences(std::string_view content,
+                                                                              const std::vector<SymbolId>& names) {
+    std::vector<std::string_view> views;
+    for (auto name : names) views.push_back(InternedString::fromId(name).view());
+    
+    std::vector<Occurrence> found;
+    forEachIdentifier(content, [&](std::string_view word, int line, size_t lineStart, size_t offset) {
+        for (size_t k = 0; k < views.size(); ++k) {
+            if (word == views[k]) {
+                found.push_back({line, utf16Column(content, lineStart, offset), names[k], offset});
+                break;
+            }
+        }
+    });
+    return found;
+}
+
+json CrossReferenceIndex::stats() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    size_t identifiers = 0;
+    for (const auto& [path, entry] : files_) identifiers += entry.identifiers.size();
+    return {
+        {"files", files_.size()},
+        {"identifiers", identifiers},
+        {"rescans", rescans_}
+    };
+}
+
+size_t CrossReferenceIndex::memoryBytes() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    size_t bytes = sizeof(CrossReferenceIndex);
+    for (const auto& [path, entry] : files_) {
+        bytes += sizeof(FileEntry) + path.capacity() + entry.identifiers.capacity() * sizeof(SymbolId) + 2 * sizeof(void*);
+    }
+    return bytes;
+}
+
+// =============================================================================
+// FunctionInfo 구현
+// =============================================================================
+
+std::string FunctionInfo::generateBlueprintWrapper() const {
+    std::ostringstream ss;
+    
+    ss << "UFUNCTION(BlueprintCallable, Category = \"Gameplay\")\n";
+    ss << returnType << " Blueprint_" << name << "(";
+    
+    for (size_t i = 0; i < parameters.size(); ++i) {
+        if (i > 0) ss << ", ";
+        ss << parameters[i];
+    }
+    
+    ss << ")\n{\n";
+    ss << "\t// Blueprint wrapper for " << name << "\n";
+    ss << "\treturn " << name << "(";
+    
+    // 파라미터 이름만 추출하여 함수 호출
+    for (size_t i = 0; i < parameters.size(); ++i) {
+        if (i > 0) ss << ", ";
+        // 간단한 파라미터 이름 추출 (실제로는 더 정교한 파싱 필요)
+        std::string_view parameter = parameters[i].view();
+        size_t lastSpace = parameter.find_last_of(' ');
+        if (lastSpace != std::string_view::npos) {
+            ss << parameter.substr(lastSpace + 1);
+        }
+    }
+    
+    ss << ");\n}\n";
+    
+    return ss.str();
+}
+
+// =============================================================================
+// LogIssue 구현
+// =============================================================================
+
+std::string LogIssue::formatForDisplay() const {
+    std::ostringstream ss;
+    
+    ss << "// File: " << file << ":" << line << "\n";
+    ss << "// Type: ";
+    switch (type) {
+        case LogType::Performance: ss << "Performance"; break;
+        case LogType::Memory: ss << "Memory"; break;
+        case LogType::Error: ss << "Error"; break;
+        case LogType::Blueprint: ss << "Blueprint"; break;
+        case LogType::Warning: ss << "Warning"; break;
+    }
+    ss << ", Severity: ";
+    switch (severity) {
+        case LogSeverity::Critical: ss << "Critical"; break;
+        case LogSeverity::High: ss << "High"; break;
+        case LogSeverity::Medium: ss << "Medium"; break;
+        case LogSeverity::Low: ss << "Low"; break;
+    }
+    ss << "\n";
+    ss << "// Message: " << message << "\n";
+    ss << "// Suggestion: " << suggestion << "\n";
+    
+    return ss.str();
+}
+
+// =============================================================================
+// UnrealLogAnalyzer 구현
+// =============================================================================
+
+UnrealLogAnalyzer::UnrealLogAnalyzer() {
+    initializePatterns();
+}
+
+void UnrealLogAnalyzer::initializePatterns() {
+    patterns_[LogType::Performance] = {
+        std::regex(R"(LogStats:\s+(.+)\s+took\s+(\d+\.?\d*)ms)"),
+        std::regex(R"(LogRenderer:\s+Frame\s+time:\s+(\d+\.?\d*)ms)"),
+        std::regex(R"(LogGameThread:\s+(.+)\s+(\d+\.?\d*)ms)"),
+        std::regex(R"(LogSlate:\s+Slow\s+widget\s+update.*(\d+\.?\d*)ms)")
+    };
+    
+    patterns_[LogType::Memory] = {
+        std::regex(R"(LogMemory:\s+(\d+)\s+bytes\s+leaked)"),
+        std::regex(R"(LogGC:\s+Garbage\s+collection\s+took\s+(\d+\.?\d*)ms)"),
+        std::regex(R"(LogMemory:\s+Out\s+of\s+memory)"),
+        std::regex(R"(LogMemory:\s+Allocation\s+failed.*size:\s+(\d+))")
+    };
+    
+    patterns_[LogType::Error] = {
+        std::regex(R"(LogTemp:\s+Error:\s+(.+))"),
+        std::regex(R"(LogCore:\s+Error:\s+(.+))"),
+        std::regex(R"(LogBlueprint:\s+Error:\s+(.+))"),
+        std::regex(R"(LogCompile:\s+Error:\s+(.+))"),
+        std::regex(R"(Error:\s+(.+))")
+    };
+    
+    patterns_[LogType::Blueprint] = {
+        std::regex(R"(LogBlueprint:\s+(.+)\s+failed\s+to\s+compile)"),
+        std::regex(R"(LogBlueprintUserMessages:\s+(.+))"),
+        std::regex(R"(LogBlueprint:\s+Warning:\s+(.+))"),
+        std::regex(R"(Blueprint\s+compile\s+error:\s+(.+))")
+    };
+    
+    patterns_[LogType::Warning] = {
+        std::regex(R"(LogTemp:\s+Warning:\s+(.+))"),
+        std::regex(R"(LogCore:\s+Warning:\s+(.+))"),
+        std::regex(R"(Warning:\s+(.+))")
+    };
+}
+
+std::vector<LogIssue> UnrealLogAnalyzer::analyzeProject(const std::string& projectPath) {
+    std::vector<LogIssue> allIssues;
+    
+    auto logFiles = findLogFiles(projectPath);
+    
+    for (const auto& logFile : logFiles) {
+        auto issues = analyzeLogFile(logFile);
+        allIssues.insert(allIssues.end(), issues.begin(), issues.end());
+    }
+    
+    return allIssues;
+}
+
+std::string UnrealLogAnalyzer::generateAnalysisReport(const std::vector<LogIssue>& issues) {
+    std::ostringstream report;
+    
+    report << "/*\n";
+    report << " * UNREAL ENGINE LOG ANALYSIS REPORT\n";
+    report << " * Generated: " << std::chrono::system_clock::now().time_since_epoch().count() << "\n";
+    report << " * Total Issues Found: " << issues.size() << "\n";
+    report << " * ==========================================\n";
+    report << " */\n\n";
+    
+    std::unordered_map<LogSeverity, std::vector<LogIssue>> groupedIssues;
+    for (const auto& issue : issues) {
+        groupedIssues[issue.severity].push_back(issue);
+    }
+    
+    for (auto severity : {LogSeverity::Critical, LogSeverity::High, LogSeverity::Medium, LogSeverity::Low}) {
+        if (groupedIssues[severity].empty()) continue;
+        
+        report << "// " << static_cast<int>(severity) << " SEVERITY ISSUES (" << groupedIssues[severity].size() << ")\n";
+        report << "// " << std::string(50, '=') << "\n";
+        
+        for (const auto& issue : groupedIssues[severity]) {
+            report << issue.formatForDisplay() << "\n";
+        }
+        
+        report << "\n";
+    }
+    
+    return report.str();
+}
+
+std::vector<std::string> UnrealLogAnalyzer::findLogFiles(const std::string& projectPath) {
+    std::vector<std::string> logFiles;
+    
+    std::vector<std::string> logPaths = {
+        projectPath + "/Saved/Logs",
+        projectPath + "/Intermediate/Build/Win64/UnrealHeaderTool/Development/Engine/Logs"
+    };
+    
+    for (const auto& logPath : logPaths) {
+        if (fs::exists(logPath)) {
+            try {
+                for (const auto& entry : fs::directory_iterator(logPath)) {
+                    if (entry.is_regular_file() && entry.path().extension() == ".log") {
+                        logFiles.push_back(entry.path().string());
+                    }
+                }
+            } catch (const fs::filesystem_error&) {
+                // 권한 오류 등 무시
+            }
+        }
+    }
+    
+    return logFiles;
+}
+
+std::vector<LogIssue> UnrealLogAnalyzer::analyzeLogFile(const std::string& logFile) {
+    std::vector<LogIssue> issues;
+    
+    std::ifstream file(logFile);
+    if (!file.is_open()) return issues;
+    
+    std::string line;
+    int lineNum = 0;
+    
+    while (std::getline(file, line)) {
+        lineNum++;
+        
+        for (const auto& [logType, patterns] : patterns_) {
+            for (const auto& pattern : patterns) {
+                std::smatch match;
+                if (std::regex_search(line, match, pattern)) {
+                    LogIssue issue;
+                    issue.type = logType;
+                    issue.message = match[0].str();
+                    issue.file = InternedString(logFile);
+                    issue.line = lineNum;
+                    issue.severity = LogSeverity::Medium; // 기본값
+                    issue.suggestion = InternedString("Check the related code section");
+                    
+                    issues.push_back(issue);
+                    break;
+                }
+            }
+        }
+    }
+    
+    return issues;
+}
+
+// =============================================================================
+// CompileError 구현
+// =============================================================================
+
+std::string CompileError::formatSolution() const {
+    std::ostringstream ss;
+    
+    ss << "// Error in " << file << ":" << line << "\n";
+    ss << "// Category: " << static_cast<int>(category) << "\n";
+    ss << "// Confidence: " << (confidence * 100) << "%\n";
+    ss << "// Message: " << message << "\n";
+    ss << "// Solution: " << solution << "\n";
+    
+    return ss.str();
+}
+
+// =============================================================================
+// CompileErrorInterpreter 구현
+// =============================================================================
+
+CompileErrorInterpreter::CompileErrorInterpreter() {
+    initializePatterns();
+}
+
+void CompileErrorInterpreter::initializePatterns() {
+    patterns_ = {
+        {
+            std::regex(R"(error: use of undeclared identifier '(\w+)')"),
+            ErrorCategory::MissingInclude,
+            "Add #include for '{1}' or check spelling. Common includes for '{1}': CoreMinimal.h, Engine.h",
+            0.9
+        },
+        {
+            std::regex(R"(error: unknown type name '(\w+)')"),
+            ErrorCategory::MissingInclude,
+            "Add #include for the header that declares '{1}'",
+            0.85
+        },
+        {
+            std::regex(R"(error: .*incomplete type '(?:class |struct )?(\w+)')"),
+            ErrorCategory::MissingInclude,
+            "'{1}' is only forward declared here. Add #include for the header that declares it",
+            0.85
+        },
+        {
+            std::regex(R"(error: no member named '(\w+)' in)"),
+            ErrorCategory::MemberNotFound,
+            "Member '{1}' does not exist. Check spelling, access level, or add forward declaration",
+            0.8
+        },
+        {
+            std::regex(R"(error: UCLASS\(\) must be the first thing)"),
+            ErrorCategory::UnrealMacro,
+            "Move UCLASS() macro to immediately before class declaration",
+            0.95
+        },
+        {
+            std::regex(R"(error: GENERATED_BODY\(\) not found)"),
+            ErrorCategory::UnrealMacro,
+            "Add GENERATED_BODY() as first line inside UCLASS body",
+            0.95
+        },
+        {
+            std::regex(R"(#include found after \.generated\.h file)"),
+            ErrorCategory::UnrealMacro,
+            "Move the .generated.h include so it is the last #include in the header",
+            0.95
+        },
+        {
+            std::regex(R"(error: Cannot find definition for module '(\w+)')"),
+            ErrorCategory::ModuleNotFound,
+            "Add '{1}' to PublicDependencyModuleNames in your .Build.cs file",
+            0.9
+        }
+    };
+}
+
+std::vector<CompileError> CompileErrorInterpreter::analyzeErrors(const std::string& projectPath) {
+    auto errorMessages = extractCompileErrors(projectPath);
+    std::vector<CompileError> errors;
+    
+    for (const auto& message : errorMessages) {
+        auto error = interpretError(message);
+        errors.push_back(error);
+    }
+    
+    return errors;
+}
+
+std::string CompileErrorInterpreter::generateErrorReport(const std::vector<CompileError>& errors) {
+    std::ostringstream report;
+    
+    report << "/*\n";
+    report << " * COMPILE ERROR ANALYSIS & SOLUTIONS\n";
+    report << " * Found " << errors.size() << " compile errors\n";
+    report << " * ==========================================\n";
+    report << " */\n\n";
+    
+    for (size_t i = 0; i < errors.size() && i < 20; ++i) {
+        const auto& error = errors[i];
+        
+        report << "// ERROR #" << (i + 1) << " [" << static_cast<int>(error.category) << "]\n";
+        report << "// " << std::string(50, '-') << "\n";
+        report << error.formatSolution() << "\n\n";
+    }
+    
+    return report.str();
+}
+
+std::vector<std::string> CompileErrorInterpreter::extractCompileErrors(const std::string& projectPath) {
+    std::vector<std::string> errors;
+    
+    // 빌드 로그에서 에러 메시지 추출
+    std::string logPath = projectPath + "/Saved/Logs/UnrealBuildTool.log";
+    
+    if (fs::exists(logPath)) {
+        std::ifstream file(logPath);
+        std::string line;
+        
+        while (std::getline(file, line)) {
+            if (line.find("error:") != std::string::npos) {
+                errors.push_back(line);
+            }
+        }
+    }
+    
+    return errors;
+}
+
+CompileError CompileErrorInterpreter::interpretError(const std::string& errorMessage) const {
+    CompileError error;
+    error.message = errorMessage;
+    error.category = ErrorCategory::Unknown;
+    error.confidence = 0.0;
+    error.solution = "Manual investigation required";
+    
+    for (const auto& pattern : patterns_) {
+        std::smatch match;
+        if (std::regex_search(errorMessage, match, pattern.pattern)) {
+            error.category = pattern.category;
+            error.confidence = pattern.confidence;
+            error.solution = pattern.solution;
+            if (match.size() > 1) {
+                error.subject = match[1].str();
+                for (size_t at = error.solution.find("{1}"); at != std::string::npos; at = error.solution.find("{1}", at)) {
+                    error.solution.replace(at, 3, error.subject);
+                    at += error.subject.size();
+                }
+            }
+            break;
+        }
+    }
+    
+    return error;
+}
+
+// =============================================================================
+// UnrealCodeGenerator 구현
+// =============================================================================
+
+std::string UnrealCodeGenerator::generateUClass(const ClassTemplate& template_) {
+    std::ostringstream ss;
+    
+    ss << "#pragma once\n\n";
+    ss << "#include \"CoreMinimal.h\"\n";
+    ss << "#include \"" << template_.baseClass << ".h\"\n";
+    ss << "#include \"" << template_.className << ".generated.h\"\n\n";
+    
+    ss << "UCLASS(";
+    if (template_.isBlueprintType) ss << "BlueprintType";
+    if (template_.isBlueprintable) {
+        if (template_.isBlueprintType) ss << ", ";
+        ss << "Blueprintable";
+    }
+    ss << ")\n";
+    
+    ss << "class " << template_.moduleName << "_API " << template_.className;
+    ss << " : public " << template_.baseClass << "\n{\n";
+    ss << "\tGENERATED_BODY()\n\n";
+    
+    ss << "public:\n";
+    ss << "\t" << template_.className << "();\n\n";
+    
+    if (template_.baseClass == "AActor" || template_.baseClass == "APawn") {
+        ss << "protected:\n";
+        ss << "\tvirtual void BeginPlay() override;\n\n";
+        ss << "public:\n";
+        ss << "\tvirtual void Tick(float DeltaTime) override;\n\n";
+    }
+    
+    for (const auto& component : template_.components) {
+        ss << "\tUPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = \"Components\")\n";
+        ss << "\tclass " << component << "* " << component.substr(1) << "Component;\n\n";
+    }
+    
+    for (const auto& func : template_.customFunctions) {
+        ss << "\tUFUNCTION(BlueprintCallable, Category = \"Gameplay\")\n";
+        ss << "\tvoid " << func << "();\n\n";
+    }
+    
+    ss << "};";
+    
+    return ss.str();
+}
+
+std::string UnrealCodeGenerator::generateUStruct(const std::string& structName, const std::vector<std::string>& members) {
+    std::ostringstream ss;
+    
+    ss << "USTRUCT(BlueprintType)\n";
+    ss << "struct F" << structName << "\n{\n";
+    ss << "\tGENERATED_USTRUCT_BODY()\n\n";
+    
+    for (const auto& member : members) {
+        ss << "\tUPROPERTY(EditAnywhere, BlueprintReadWrite)\n";
+        ss << "\t" << member << ";\n\n";
+    }
+    
+    ss << "};";
+    
+    return ss.str();
+}
+
+std::string UnrealCodeGenerator::generateUFunction(const std::string& functionName, const std::vector<std::string>& parameters) {
+    std::ostringstream ss;
+    
+    ss << "UFUNCTION(BlueprintCallable, Category = \"Gameplay\")\n";
+    ss << "void " << functionName << "(";
+    
+    for (size_t i = 0; i < parameters.size(); ++i) {
+        if (i > 0) ss << ", ";
+        ss << parameters[i];
+    }
+    
+    ss << ");\n";
+    
+    return ss.str();
+}
+
+std::string UnrealCodeGenerator::generateUProperty(const std::string& propertyName, const std::string& type) {
+    std::ostringstream ss;
+    
+    ss << "UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = \"Default\")\n";
+    ss << type << " " << propertyName << ";\n";
+    
+    return ss.str();
+}
+
+// =============================================================================
+// VersionCompatibleAutoComplete 구현
+// =============================================================================
+
+VersionCompatibleAutoComplete::VersionCompatibleAutoComplete(std::shared_ptr<EngineIndex> engineIndex)
+    : engineVersion_(engineIndex->version()), engineIndex_(std::move(engineIndex)),
+      projectScanner_(EngineVersion{0, 0, 0, "", ""}) {}
+
+std::shared_ptr<const std::vector<json>> VersionCompatibleAutoComplete::getCompletions(const std::string& prefix,
+                                                                                     const std::string& context) {
+    // 스캐너 테이블이 바뀌었으면 이전 결과는 모두 무효
+    uint64_t generation = engineIndex_->scanner().generation() + projectScanner_.generation();
+    if (completionCacheGeneration_.exchange(generation) != generation) {
+        completionCache_.clear();
+    }
+    
+    std::string cacheKey = prefix + '\x1f' + context;
+    if (auto cached = completionCache_.get(cacheKey)) {
+        return *cached;
+    }
+    
+    std::vector<json> completions;
+    
+    auto macroCompletions = getMacroCompletions(prefix);
+    completions.insert(completions.end(), macroCompletions.begin(), macroCompletions.end());
+    
+    if (context.find("::") != std::string::npos) {
+        auto memberCompletions = getMemberCompletions(context, prefix);
+        completions.insert(completions.end(), memberCompletions.begin(), memberCompletions.end());
+    }
+    
+    size_t bytes = cacheKey.size() + sizeof(json) * completions.size();
+    for (const auto& completion : completions) {
+        for (const auto& field : completion) {
+            if (field.is_string()) bytes += field.get_ref<const std::string&>().size() + 32;
+        }
+    }
+    auto shared = std::make_shared<const std::vector<json>>(std::move(completions));
+    completionCache_.put(cacheKey, shared, bytes);
+    
+    return shared;
+}
+
+json VersionCompatibleAutoComplete::memoryStats() const {
+    return {
+        {"engine", engineVersion_.toString()},
+        {"completionCache", completionCache_.stats()},
+        {"projectIndexBytes", projectScanner_.memoryBytes()}
+    };
+}
+
+// 공유 엔진 인덱스는 EngineIndexRegistry 쪽에서 한 번만 집계
+size_t VersionCompatibleAutoComplete::memoryBytes() const {
+    return completionCache_.bytes() + projectScanner_.memoryBytes();
+}
+
+void VersionCompatibleAutoComplete::addPluginShard(std::shared_ptr<PluginIndexShard> shard) {
+    {
+        std::lock_guard<std::mutex> lock(pluginShardsMutex_);
+        pluginShards_.push_back(std::move(shard));
+    }
+    completionCache_.clear();
+}
+
+std::vector<std::shared_ptr<PluginIndexShard>> VersionCompatibleAutoComplete::pluginShards() const {
+    std::lock_guard<std::mutex> lock(pluginShardsMutex_);
+    return pluginShards_;
+}
+
+std::vector<DynamicHeaderScanner*> VersionCompatibleAutoComplete::scanners() {
+    std::vector<DynamicHeaderScanner*> all = {&projectScanner_, &engineIndex_->scanner()};
+    for (const auto& shard : pluginShards()) {
+        all.push_back(&shard->scanner());
+    }
+    return all;
+}
+
+std::vector<SymbolRecord> VersionCompatibleAutoComplete::findSymbols(std::string_view query, size_t limit,
+                                                                     std::unordered_set<const DynamicHeaderScanner*>* queried) {
+    // 스캐너마다 limit 개씩 받아 점수로 합침 - 엔진 결과만으로 limit 이 차서 플러그인이 빠지지 않도록
+    std::vector<std::pair<int, SymbolRecord>> scored;
+    for (auto* scanner : scanners()) {
+        if (queried && !queried->insert(scanner).second) continue;
+        for (const auto& record : scanner->findSymbols(query, limit)) {
+            auto score = SymbolTable::fuzzyScore(InternedString::fromId(record.name).view(), record.kind, query);
+            scored.emplace_back(score.value_or(0), record);
+        }
+    }
+    // 점수가 같으면 스캐너 순서 (프로젝트, 엔진, 플러그인)
+    std::stable_sort(scored.begin(), scored.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    
+    std::vector<SymbolRecord> records;
+    records.reserve(std::min(limit, scored.size()));
+    for (size_t i = 0; i < scored.size() && i < limit; ++i) records.push_back(scored[i].second);
+    return records;
+}
+
+std::vector<json> VersionCompatibleAutoComplete::getMacroCompletions(const std::string& prefix) {
+    std::vector<json> completions;
+    
+    std::vector<std::string> macros = {"UCLASS", "USTRUCT", "UFUNCTION", "UPROPERTY", "UENUM"};
+    
+    for (const auto& macro : macros) {
+        if (prefix.empty() || macro.find(prefix) == 0) {
+            json completion;
+            completion["label"] = macro;
+            completion["insertText"] = engineIndex_->api().getMacroTemplate(macro, engineVersion_);
+            completion["detail"] = "Unreal Engine " + engineVersion_.toString() + " Macro";
+            completion["kind"] = 15;
+            completion["sortText"] = "0_" + macro;
+            
+            completions.push_back(completion);
+        }
+    }
+    
+    return completions;
+}
+
+std::vector<json> VersionCompatibleAutoComplete::getMemberCompletions(const std::string& context, const std::string& prefix) {
+    std::vector<json> completions;
+    
+    size_t pos = context.rfind("::");
+    if (pos == std::string::npos) return completions;
+    
+    // "::" 바로 앞의 식별자 ("Super::", "(AMyActor::" 등)
+    size_t nameStart = pos;
+    while (nameStart > 0 && isIdentifierChar(context[nameStart - 1])) --nameStart;
+    std::string className = context.substr(nameStart, pos - nameStart);
+    
+    // 엔진 + 플러그인 + 프로젝트 스캐너의 멤버 (같은 이름은 같은 id이므로 문자열 비교 없이 중복 제거)
+    std::unordered_map<InternedString, SymbolRecord> members;
+    for (auto* scanner : scanners()) {
+        for (const auto& record : scanner->getClassMembers(className)) {
+            members.emplace(InternedString::fromId(record.name), record);
+        }
+    }
+    for (const auto& method : engineIndex_->api().getClassMethods(className, engineVersion_)) {
+        members.emplace(InternedString(method), SymbolRecord{});
+    }
+    
+    for (const auto& [interned, record] : members) {
+        std::string_view member = interned.view();
+        if (prefix.empty() || member.compare(0, prefix.size(), prefix) == 0) {
+            bool generated = (record.flags & SymbolFlags::Generated) != 0;
+            
+            json completion;
+            completion["label"] = member;
+            completion["insertText"] = member;
+            completion["detail"] = className + "::" + std::string(member) + " (UE " + engineVersion_.toString() +
+                                   (generated ? ", generated by UHT)" : ")");
+            completion["kind"] = record.kind == SymbolKind::Typedef ? 7 : 2;     // Class : Method
+            completion["sortText"] = (generated ? "2_" : "1_") + std::string(member);
+            
+            completions.push_back(completion);
+        }
+    }
+    
+    return completions;
+}
+
+// =============================================================================
+// UnrealEngineAnalyzer 구현
+// =============================================================================
+
+UnrealEngineAnalyzer::UnrealEngineAnalyzer(const std::string& enginePath, const std::string& projectPath)
+    : enginePath_(enginePath), projectPath_(projectPath) {
+    
+    // 프로젝트 엔진 버전 감지
+    UnrealEngineDetector detector;
+    engineVersion_ = detector.detectProjectEngineVersion(projectPath);
+    
+    // 엔진 경로가 비어있으면 감지된 버전의 경로 사용
+    if (enginePath_.empty() && !engineVersion_.installPath.empty()) {
+        enginePath_ = engineVersion_.installPath;
+    }
+    // 설치 위치를 찾지 못한 버전이면 전달받은 엔진 경로를 스캔
+    if (engineVersion_.installPath.empty() && !enginePath_.empty()) {
+        engineVersion_.installPath = enginePath_;
+    }
+    
+    // 서브시스템들 초기화
+    logAnalyzer_ = std::make_unique<UnrealLogAnalyzer>();
+    errorInterpreter_ = std::make_unique<CompileErrorInterpreter>();
+    headerSourceLinker_ = std::make_unique<HeaderSourceLinker>();
+    blueprintIntegration_ = std::make_unique<BlueprintIntegration>();
+    codeGenerator_ = std::make_unique<UnrealCodeGenerator>();
+    
+    // 같은 엔진을 쓰는 다른 프로젝트가 있으면 인덱스와 API 테이블을 그대로 공유
+    auto engineIndex = EngineIndexRegistry::instance().acquire(engineVersion_);
+    engineIncludePaths_ = engineIndex->api().getIncludePaths(engineVersion_);
+    autoComplete_ = std::make_unique<VersionCompatibleAutoComplete>(std::move(engineIndex));
+    
+    startBackgroundIndexing();
+}
+
+std::string UnrealEngineAnalyzer::generateUClassTemplate(const std::string& className, const std::string& baseClass) {
+    ClassTemplate template_;
+    template_.className = className;
+    template_.baseClass = baseClass;
+    template_.moduleName = "GAME";
+    template_.isBlueprintType = true;
+    template_.isBlueprintable = true;
+    
+    return codeGenerator_->generateUClass(template_);
+}
+
+std::string UnrealEngineAnalyzer::generateBlueprintFunction(const std::string& uri, int line, int character) {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    
+    if (fileFunctions_.count(uri)) {
+        for (const auto& func : fileFunctions_[uri]) {
+            if (func.location.range.start.line <= line && func.location.range.end.line >= line) {
+                return func.generateBlueprintWrapper();
+            }
+        }
+    }
+    
+    return "// No function found at current position";
+}
+
+std::string UnrealEngineAnalyzer::syncHeaderSource(const std::string& uri) {
+    if (isHeaderFile(uri)) {
+        auto fileInfo = headerSourceLinker_->analyzeFilePair(uri);
+        return headerSourceLinker_->generateMissingImplementations(fileInfo);
+    } else if (isSourceFile(uri)) {
+        return headerSourceLinker_->generateHeaderFromSource(uri);
+    }
+    
+    return "// Unable to sync: not a valid header or source file";
+}
+
+std::string UnrealEngineAnalyzer::analyzeUnrealLogs(const std::string& projectPath) {
+    auto issues = logAnalyzer_->analyzeProject(projectPath);
+    return logAnalyzer_->generateAnalysisReport(issues);
+}
+
+std::string UnrealEngineAnalyzer::interpretCompileErrors(const std::string& projectPath) {
+    auto errors = errorInterpreter_->analyzeErrors(projectPath);
+    return errorInterpreter_->generateErrorReport(errors);
+}
+
+std::string UnrealEngineAnalyzer::executeCodeAction(const std::string& action, const nlohmann::json& params) {
+    std::string uri = params["textDocument"]["uri"];
+    int line = params["position"]["line"];
+    int character = params["position"]["character"];
+    
+    if (action == "generateUClass") {
+        std::string className = params.value("className", "MyActor");
+        std::string baseClass = params.value("baseClass", "AActor");
+        return generateUClassTemplate(className, baseClass);
+    }
+    else if (action == "generateBlueprintFunction") {
+        return generateBlueprintFunction(uri, line, character);
+    }
+    else if (action == "syncHeaderSource") {
+        return syncHeaderSource(uri);
+    }
+    else if (action == "analyzeLogs") {
+        return analyzeUnrealLogs(projectPath_);
+    }
+    else if (action == "interpretErrors") {
+        return interpretCompileErrors(projectPath_);
+    }
+    
+    return "// Unknown action: " + action;
+}
+
+std::vector<CompletionItem> UnrealEngineAnalyzer::getCompletions(
+    const std::string& uri,
+    int line,
+    int character,
+    const std::string& text
+) {
+    std::lock_guard<std::mutex> lock(dataMutex_);
+    
+    std::string currentWord = getCurrentWord(text, line, character);
+    std::string context = detectUnrealContext(text, line, character);
+    
+    std::vector<CompletionItem> completions;
+    
+    // 버전 호환 자동완성 사용
+    auto jsonCompletions = autoComplete_->getCompletions(currentWord, context);
+    
+    for (const auto& jsonCompletion : *jsonCompletions) {
+        CompletionItem item;
+        item.label = jsonCompletion["label"];
+        item.insertText = jsonCompletion["insertText"];
+        item.detail = jsonCompletion["detail"];
+        item.kind = jsonCompletion["kind"];
+        item.sortText = jsonCompletion["sortText"];
+        
+        completions.push_back(item);
+    }
+    
+    return completions;
+}
+
+json UnrealEngineAnalyzer::findWorkspaceSymbols(const std::string& query,
+                                                std::unordered_set<const DynamicHeaderScanner*>* queried) {
+    json symbols = json::array();
+    
+    for (const auto& record : autoComplete_->findSymbols(query, 256, queried)) {
+        int kind = 12;  // Function
+        switch (record.kind) {
+            case SymbolKind::Class: kind = 5; break;
+            case SymbolKind::Struct: kind = 23; break;
+            case SymbolKind::Function: kind = record.owner ? 6 : 12; break;
+            case SymbolKind::Property: kind = 7; break;
+            case SymbolKind::Enum: kind = 10; break;
+            case SymbolKind::Typedef: kind = 5; break;
+        }
+        
+        json symbol = {
+            {"name", InternedString::fromId(record.name).view()},
+            {"kind", kind},
+            {"location", {
+                {"uri", pathToUri(InternedString::fromId(record.file).str())},
+                {"range", {
+                    {"start", {{"line", record.startLine}, {"character", 0}}},
+                    {"end", {{"line", record.endLine}, {"character", 0}}}
+                }}
+            }}
+        };
+        if (record.owner) {
+            symbol["containerName"] = InternedString::fromId(record.owner).view();
+        }
+        symbols.push_back(symbol);
+    }
+    
+    return symbols;
+}
+
+UnrealEngineAnalyzer::~UnrealEngineAnalyzer() {
+    cancelled_ = true;
+    autoComplete_->projectScanner().cancel();
+    std::lock_guard<std::mutex> lock(indexThreadMutex_);
+    if (indexThread_.joinable()) {
+        indexThread_.join();
+    }
+}
+
+void UnrealEngineAnalyzer::waitForIndexing() {
+    autoComplete_->waitForIndexing();
+    
+    std::lock_guard<std::mutex> lock(indexThreadMutex_);
+    if (indexThread_.joinable()) {
+        indexThread_.join();
+    }
+}
+
+void UnrealEngineAnalyzer::applyMemoryBudget(const MemoryBudget& budget) {
+    autoComplete_->setCacheBudget(budget.cacheBytes());
+    includeUsageCache_.setCapacity(budget.cacheBytes());
+}
+
+void UnrealEngineAnalyzer::limitCaches(size_t bytes) {
+    autoComplete_->setCacheBudget(bytes);
+    includeUsageCache_.setCapacity(bytes);
+}
+
+size_t UnrealEngineAnalyzer::cacheBytes() const {
+    return autoComplete_->cacheBytes() + includeUsageCache_.bytes();
+}
+
+void UnrealEngineAnalyzer::compactIndexes() {
+    autoComplete_->compactIndexes();
+}
+
+json UnrealEngineAnalyzer::memoryStats() const {
+    auto stats = autoComplete_->memoryStats();
+    stats["crossReferences"] = crossReferences_.stats();
+    return stats;
+}
+
+size_t UnrealEngineAnalyzer::memoryBytes() const {
+    return autoComplete_->memoryBytes() + crossReferences_.memoryBytes();
+}
+
+void UnrealEngineAnalyzer::startBackgroundIndexing() {
+    // 프로젝트 헤더를 먼저, 그 다음 .uproject가 켠 플러그인만 샤드로 붙임 (같은 플러그인은 프로젝트 간 공유)
+    std::lock_guard<std::mutex> lock(indexThreadMutex_);
+    indexThread_ = std::thread([this]() {
+        try {
+            std::vector<std::string> headers;
+            std::error_code ec;
+            for (fs::recursive_directory_iterator it(projectPath_ + "/Source", ec), end; !ec && it != end; it.increment(ec)) {
+                if (it->is_regular_file(ec) && it->path().extension() == ".h") {
+                    headers.push_back(it->path().string());
+                }
+            }
+            {
+                std::lock_guard<std::mutex> dataLock(dataMutex_);
+                for (const auto& header : headers) {
+                    projectHeadersByStem_[fs::path(header).stem().string()].push_back(header);
+                }
+            }
+            autoComplete_->projectScanner().scanFiles(headers);
+            if (cancelled_) return;
+            
+            auto plugins = PluginCatalog::resolveEnabled(projectPath_, engineIndex()->enginePlugins());
+            for (const auto& plugin : plugins) {
+                if (cancelled_) return;
+                autoComplete_->addPluginShard(PluginShardRegistry::instance().acquire(plugin));
+            }
+            if (!plugins.empty()) {
+                std::cerr << "🧩 Indexed " << plugins.size() << " enabled plugin(s) for " << projectPath_ << std::endl;
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "Project indexing failed: " << e.what() << std::endl;
+        }
+    });
+}
+
+void UnrealEngineAnalyzer::refreshHeader(const std::string& filePath) {
+    includeGraphStale_ = true;      // 다음 질의 때 바뀐 파일만 다시 읽어 재구성
+    
+    static const std::string GeneratedSuffix = ".generated.h";
+    const std::string sourceRoot = projectPath_ + "/Source/";
+    
+    std::vector<std::string> headers;
+    if (endsWith(filePath, GeneratedSuffix)) {
+        // UHT 가 다시 만든 출력 (Intermediate/Build/**/Inc) -> 원본 헤더를 다시 스캔
+        std::string fileName = fs::path(filePath).filename().string();
+        std::string stem = fileName.substr(0, fileName.size() - GeneratedSuffix.size());
+        
+        std::lock_guard<std::mutex> lock(dataMutex_);
+        auto it = projectHeadersByStem_.find(stem);
+        if (it != projectHeadersByStem_.end()) headers = it->second;
+    } else if (endsWith(filePath, ".h") && filePath.compare(0, sourceRoot.size(), sourceRoot) == 0) {
+        std::lock_guard<std::mutex> lock(dataMutex_);
+        auto& known = projectHeadersByStem_[fs::path(filePath).stem().string()];
+        if (std::find(known.begin(), known.end(), filePath) == known.end()) known.push_back(filePath);
+        headers.push_back(filePath);
+    }
+    
+    for (const auto& header : headers) {
+        autoComplete_->projectScanner().rescanFile(header);
+    }
+}
+
+namespace {
+
+// UPROPERTY 타입의 메모리 크기 추정 (UE5 는 Large World Coordinates 로 FVector 계열이 double)
+std::optional<size_t> estimatedPropertyBytes(std::string_view type, const EngineVersion& version) {
+    if (type.compare(0, 6, "const ") == 0) type.remove_prefix(6);
+    
+    // 고정 배열 "int32[4]"
+    size_t count = 1;
+    if (!type.empty() && type.back() == ']') {
+        size_t open = type.rfind('[');
+        if (open == std::string_view::npos) return std::nullopt;
+        std::string_view dimension = type.substr(open + 1, type.size() - open - 2);
+        if (dimension.empty() || !std::all_of(dimension.begin(), dimension.end(), ::isdigit)) return std::nullopt;
+        count = std::stoul(std::string(dimension));
+        type = type.substr(0, open);
+    }
+    
+    const size_t real = version.isUE5() ? 8 : 4;
+    size_t bytes = 0;
+    if (!type.empty() && type.back() == '*') bytes = 8;
+    else if (type.compare(0, 5, "TMap<") == 0 || type.compare(0, 5, "TSet<") == 0) bytes = 80;
+    else if (type.compare(0, 7, "TArray<") == 0) bytes = 16;
+    else if (type.compare(0, 11, "TObjectPtr<") == 0 || type.compare(0, 12, "TSubclassOf<") == 0) bytes = 8;
+    else if (type.compare(0, 15, "TWeakObjectPtr<") == 0) bytes = 8;
+    else if (type.compare(0, 15, "TSoftObjectPtr<") == 0 || type.compare(0, 14, "TSoftClassPtr<") == 0) bytes = 40;
+    else if (type.compare(0, 12, "TEnumAsByte<") == 0) bytes = 1;
+    else {
+        static const std::unordered_map<std::string_view, size_t> fixed = {
+            {"bool", 1}, {"uint8", 1}, {"int8", 1},
+            {"int16", 2}, {"uint16", 2},
+            {"int32", 4}, {"uint32", 4}, {"float", 4}, {"int", 4},
+            {"int64", 8}, {"uint64", 8}, {"double", 8},
+            {"FName", 8}, {"FColor", 4}, {"FLinearColor", 16}, {"FIntPoint", 8}, {"FIntVector", 12},
+            {"FString", 16}, {"FText", 24}, {"FGameplayTag", 8}, {"FGuid", 16}, {"FDateTime", 8},
+        };
+        if (auto it = fixed.find(type); it != fixed.end()) {
+            bytes = it->second;
+        } else if (type == "FVector" || type == "FRotator") {
+            bytes = 3 * real;
+        } else if (type == "FVector2D") {
+            bytes = 2 * real;
+        } else if (type == "FQuat" || type == "FVector4" || type == "FPlane") {
+            bytes = 4 * real;
+        } else if (type == "FTransform") {
+            bytes = 10 * real + (version.isUE5() ? 16 : 8);    // 회전/이동/스케일 (SIMD 정렬 패딩 포함)
+        } else if (type.size() > 1 && type[0] == 'E' && std::isupper(static_cast<unsigned char>(type[1]))) {
+            bytes = 1;      // UENUM 은 대부분 uint8
+        } else {
+            return std::nullopt;
+        }
+    }
+    return bytes * count;
+}
+
+} // namespace
+
+json UnrealEngineAnalyzer::replicationReport(bool includeEngine) {
+    UNREAL_TRACE_SPAN("replicationReport", "analyzer", 0);
+    
+    // 각 인덱스에서 Replicated 비트가 켜진 Property 행만 한 번에 훑음
+    std::vector<DynamicHeaderScanner*> scanners = {&autoComplete_->projectScanner()};
+    auto shards = autoComplete_->pluginShards();
+    for (const auto& shard : shards) {
+        if (shard->descriptor().isProjectPlugin || includeEngine) scanners.push_back(&shard->scanner());
+    }
+    if (includeEngine) {
+        autoComplete_->waitForIndexing();
+        scanners.push_back(&autoComplete_->engineIndex()->scanner());
+    }
+    
+    struct ClassReport {
+        json properties = json::array();
+        size_t estimatedBytes = 0;
+        size_t repNotify = 0;
+        size_t unknownSize = 0;
+        std::string file;
+    };
+    std::unordered_map<SymbolId, ClassReport> classes;
+    size_t totalProperties = 0;
+    size_t totalBytes = 0;
+    size_t unknownTotal = 0;
+    
+    for (auto* scanner : scanners) {
+        for (const auto& property : scanner->propertiesWithFlags(PropertyFlags::Replicated)) {
+            if (property.flags & PropertyFlags::NotReplicated) continue;
+            
+            auto& report = classes[property.owner];
+            std::string_view type = InternedString::fromId(property.type).view();
+            auto bytes = estimatedPropertyBytes(type, engineVersion_);
+            bool repNotify = (property.flags & PropertyFlags::RepNotify) != 0;
+            
+            json entry = {
+                {"name", InternedString::fromId(property.name).str()},
+                {"type", std::string(type)},
+                {"line", property.startLine},
+                {"repNotify", repNotify},
+                {"specifiers", PropertyFlags::toJson(property.flags)}
+            };
+            entry["estimatedBytes"] = bytes ? json(*bytes) : json(nullptr);
+            report.properties.push_back(std::move(entry));
+            if (report.file.empty()) report.file = InternedString::fromId(property.file).str();
+            
+            report.estimatedBytes += bytes.value_or(0);
+            report.repNotify += repNotify ? 1 : 0;
+            report.unknownSize += bytes ? 0 : 1;
+            totalBytes += bytes.value_or(0);
+            unknownTotal += bytes ? 0 : 1;
+            ++totalProperties;
+        }
+    }
+    
+    std::vector<std::pair<SymbolId, ClassReport*>> ordered;
+    for (auto& [owner, report] : classes) ordered.emplace_back(owner, &report);
+    std::sort(ordered.begin(), ordered.end(), [](const auto& a, const auto& b) {
+        if (a.second->estimatedBytes != b.second->estimatedBytes) {
+            return a.second->estimatedBytes > b.second->estimatedBytes;
+        }
+        return InternedString::fromId(a.first).view() < InternedString::fromId(b.first).view();
+    });
+    
+    json classList = json::array();
+    for (auto& [owner, report] : ordered) {
+        classList.push_back({
+            {"class", InternedString::fromId(owner).str()},
+            {"file", report->file},
+            {"replicatedProperties", report->properties.size()},
+            {"repNotifyProperties", report->repNotify},
+            {"estimatedBytes", report->estimatedBytes},
+            {"unknownSizeProperties", report->unknownSize},
+            {"properties", std::move(report->properties)}
+        });
+    }
+    
+    return {
+        {"engineVersion", engineVersion_.toString()},
+        {"includeEngine", includeEngine},
+        {"sizeModel", std::string("in-memory sizeof, ") + (engineVersion_.isUE5() ? "double" : "float") +
+                      " vectors; containers count the header only"},
+        {"classes", std::move(classList)},
+        {"totals", {
+            {"classes", classes.size()},
+            {"replicatedProperties", totalProperties},
+            {"estimatedBytes", totalBytes},
+            {"unknownSizeProperties", unknownTotal}
+        }}
+    };
+}
+
+IncludeGraph& UnrealEngineAnalyzer::includeGraph() {
+    if (!includeGraphStale_.exchange(false)) return includeGraph_;
+    
+    // 엔진 include 경로의 헤더 + 프로젝트/플러그인 Source 의 헤더와 소스
+    std::vector<std::string> files;
+    auto collect = [&files](const std::string& root, bool sources) {
+        std::error_code ec;
+        for (fs::recursive_directory_iterator it(root, ec), end; !ec && it != end; it.increment(ec)) {
+            if (!it->is_regular_file(ec)) continue;
+            auto extension = it->path().extension();
+            if (extension == ".h" || (sources && (extension == ".cpp" || extension == ".inl"))) {
+                files.push_back(it->path().string());
+            }
+        }
+    };
+    
+    const std::string& installPath = engineIndex()->version().installPath;
+    for (const auto& includePath : engineIncludePaths_) {
+        if (!installPath.empty()) collect(installPath + "/" + includePath, false);
+    }
+    collect(projectPath_ + "/Source", true);
+    for (const auto& shard : autoComplete_->pluginShards()) {
+        collect(shard->descriptor().rootPath + "/Source", true);
+    }
+    
+    includeGraph_.build(files);
+    auto stats = includeGraph_.stats();
+    std::cerr << "🔗 Include graph: " << stats["files"] << " files, " << stats["edges"] << " edges ("
+              << stats["buildSeconds"].get<double>() << "s)" << std::endl;
+    return includeGraph_;
+}
+
+namespace {
+
+bool isTranslationUnit(std::string_view path) {
+    return path.size() > 4 && path.compare(path.size() - 4, 4, ".cpp") == 0;
+}
+
+// unity 묶음 제안용 MinHash 서명 길이와 LSH 밴드 높이
+constexpr size_t UnitySignatureSize = 32;
+constexpr size_t UnityBandRows = 4;
+using UnitySignature = std::array<uint32_t, UnitySignatureSize>;
+
+uint32_t minHashOf(uint32_t node, size_t seed) {
+    uint64_t x = ((uint64_t{node} << 8) | seed) + 0x9E3779B97F4A7C15ull;       // splitmix64
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return static_cast<uint32_t>(x ^ (x >> 31));
+}
+
+double estimatedJaccard(const UnitySignature& a, const UnitySignature& b) {
+    size_t equal = 0;
+    for (size_t k = 0; k < UnitySignatureSize; ++k) equal += a[k] == b[k] ? 1 : 0;
+    return static_cast<double>(equal) / UnitySignatureSize;
+}
+
+} // namespace
+
+json UnrealEngineAnalyzer::transitiveIncludes(const std::string& filePath, size_t limit) {
+    std::lock_guard<std::mutex> lock(includeGraphMutex_);
+    auto& graph = includeGraph();
+    auto node = graph.find(filePath);
+    if (!node) return {{"file", filePath}, {"error", "File is not part of the include graph"}};
+    
+    auto closure = graph.transitiveIncludes(*node);
+    json includes = json::array();
+    for (size_t i = 0; i < closure.nodes.size() && i < limit; ++i) {
+        includes.push_back(graph.path(closure.nodes[i]));
+    }
+    
+    return {
+        {"file", filePath},
+        {"directIncludes", graph.directIncludeCount(*node)},
+        {"transitiveIncludes", closure.nodes.size()},
+        {"transitiveBytes", closure.bytes},
+        {"includes", includes},
+        {"truncated", closure.nodes.size() > limit}
+    };
+}
+
+json UnrealEngineAnalyzer::includeDependents(const std::string& filePath, size_t limit) {
+    std::lock_guard<std::mutex> lock(includeGraphMutex_);
+    auto& graph = includeGraph();
+    auto node = graph.find(filePath);
+    if (!node) return {{"file", filePath}, {"error", "File is not part of the include graph"}};
+    
+    // 헤더를 바꾸면 다시 컴파일되는 것은 그 헤더를 (전이적으로) include 하는 .cpp
+    auto closure = graph.dependents(*node);
+    json translationUnits = json::array();
+    json headers = json::array();
+    size_t translationUnitCount = 0;
+    for (auto dependent : closure.nodes) {
+        std::string_view path = graph.path(dependent);
+        bool translationUnit = isTranslationUnit(path);
+        translationUnitCount += translationUnit ? 1 : 0;
+        auto& list = translationUnit ? translationUnits : headers;
+        if (list.size() < limit) list.push_back(path);
+    }
+    
+    return {
+        {"file", filePath},
+        {"directIncluders", graph.directIncluders(*node).size()},
+        {"dependents", closure.nodes.size()},
+        {"translationUnits", translationUnitCount},
+        {"rebuild", translationUnits},
+        {"dependentHeaders", headers}
+    };
+}
+
+json UnrealEngineAnalyzer::heaviestIncludes(bool projectOnly, size_t limit) {
+    std::lock_guard<std::mutex> lock(includeGraphMutex_);
+    auto& graph = includeGraph();
+    const std::string projectPrefix = projectPath_ + "/";
+    
+    // 후보: 프로젝트 파일이 직접 include 하는 헤더 (projectOnly 가 아니면 모든 헤더)
+    std::vector<IncludeGraph::NodeId> candidates;
+    std::vector<size_t> includedBy;
+    for (IncludeGraph::NodeId node = 0; node < graph.nodeCount(); ++node) {
+        if (isTranslationUnit(graph.path(node))) continue;
+        
+        size_t count = 0;
+        for (auto includer : graph.directIncluders(node)) {
+            if (!projectOnly || graph.path(includer).compare(0, projectPrefix.size(), projectPrefix) == 0) ++count;
+        }
+        if (projectOnly && count == 0) continue;
+        candidates.push_back(node);
+        includedBy.push_back(count);
+    }
+    
+    // 후보마다 BFS 하지 않고 공유 부분 그래프에서 한 번에 (headerCostReport 와 같은 방식)
+    const size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    auto closures = graph.closureCosts(candidates, workers);
+    
+    struct Entry {
+        IncludeGraph::NodeId node;
+        size_t includedBy;
+        uint32_t includes;
+        uint64_t bytes;         // 자신 포함
+    };
+    std::vector<Entry> entries;
+    entries.reserve(candidates.size());
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        entries.push_back({candidates[i], includedBy[i], closures[i].includes, closures[i].bytes + graph.fileBytes(candidates[i])});
+    }
+    
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        if (a.bytes != b.bytes) return a.bytes > b.bytes;
+        return a.node < b.node;
+    });
+    if (entries.size() > limit) entries.resize(limit);
+    
+    json headers = json::array();
+    for (const auto& entry : entries) {
+        headers.push_back({
+            {"file", graph.path(entry.node)},
+            {"transitiveIncludes", entry.includes},
+            {"transitiveBytes", entry.bytes},
+            {"includedBy", entry.includedBy}
+        });
+    }
+    
+    return {
+        {"scope", projectOnly ? "project" : "all"},
+        {"graph", graph.stats()},
+        {"headers", headers}
+    };
+}
+
+json UnrealEngineAnalyzer::headerCostReport(size_t limit) {
+    UNREAL_TRACE_SPAN("headerCostReport", "analyzer", 0);
+    auto started = std::chrono::steady_clock::now();
+    
+    std::lock_guard<std::mutex> lock(includeGraphMutex_);
+    auto& graph = includeGraph();
+    const std::string projectPrefix = projectPath_ + "/";
+    
+    // 프로젝트 헤더와 번역 단위만 계산 (엔진 헤더는 이들의 전이 비용에만 기여)
+    std::vector<IncludeGraph::NodeId> headers, translationUnits;
+    for (IncludeGraph::NodeId node = 0; node < graph.nodeCount(); ++node) {
+        std::string_view path = graph.path(node);
+        if (path.compare(0, projectPrefix.size(), projectPrefix) != 0) continue;
+        (isTranslationUnit(path) ? translationUnits : headers).push_back(node);
+    }
+    
+    // 공유 include 는 자식 비용을 더하면 중복 계산되므로 닫힘 집합의 크기로 (IncludeGraph::closureCosts)
+    struct NodeCost {
+        uint64_t bytes = 0;         // 자신 포함
+        uint64_t lines = 0;
+        size_t includes = 0;
+        std::vector<IncludeGraph::NodeId> dependentUnits;     // 헤더만: 이 헤더를 (전이적으로) include 하는 .cpp
+    };
+    std::vector<IncludeGraph::NodeId> work = headers;
+    work.insert(work.end(), translationUnits.begin(), translationUnits.end());
+    std::unordered_map<IncludeGraph::NodeId, size_t> slot;
+    for (size_t i = 0; i < work.size(); ++i) slot[work[i]] = i;
+    std::vector<NodeCost> costs(work.size());
+    
+    const size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    auto closures = graph.closureCosts(work, workers);
+    for (size_t i = 0; i < work.size(); ++i) {
+        costs[i].bytes = closures[i].bytes + graph.fileBytes(work[i]);
+        costs[i].lines = closures[i].lines + graph.fileLines(work[i]);
+        costs[i].includes = closures[i].includes;
+    }
+    
+    // 헤더별 역방향 탐색 대신 번역 단위의 닫힘을 뒤집어 "이 헤더를 끌어오는 .cpp" 를 구함
+    graph.closureCosts(translationUnits, workers, [&](size_t unit, IncludeGraph::NodeId include) {
+        auto it = slot.find(include);
+        if (it != slot.end()) costs[it->second].dependentUnits.push_back(translationUnits[unit]);
+    });
+    
+    auto costOf = [&](IncludeGraph::NodeId node) -> const NodeCost& { return costs[slot.at(node)]; };
+    
+    // 헤더 순위: 한 번 전처리하는 비용 x 그 비용을 치르는 번역 단위 수
+    auto inflation = [&](IncludeGraph::NodeId node) {
+        const auto& cost = costOf(node);
+        return cost.bytes * cost.dependentUnits.size();
+    };
+    std::sort(headers.begin(), headers.end(), [&](auto a, auto b) {
+        if (inflation(a) != inflation(b)) return inflation(a) > inflation(b);
+        return a < b;
+    });
+    std::sort(translationUnits.begin(), translationUnits.end(), [&](auto a, auto b) {
+        if (costOf(a).bytes != costOf(b).bytes) return costOf(a).bytes > costOf(b).bytes;
+        return a < b;
+    });
+    
+    json headerList = json::array();
+    for (size_t i = 0; i < headers.size() && i < limit; ++i) {
+        const auto node = headers[i];
+        const auto& cost = costOf(node);
+        auto units = cost.dependentUnits;
+        std::sort(units.begin(), units.end(), [&](auto a, auto b) { return costOf(a).bytes > costOf(b).bytes; });
+        json inflated = json::array();
+        for (size_t k = 0; k < units.size() && k < 5; ++k) inflated.push_back(graph.path(units[k]));
+        
+        headerList.push_back({
+            {"file", graph.path(node)},
+            {"bytes", graph.fileBytes(node)},
+            {"lines", graph.fileLines(node)},
+            {"transitiveIncludes", cost.includes},
+            {"transitiveBytes", cost.bytes},
+            {"transitiveLines", cost.lines},
+            {"translationUnits", cost.dependentUnits.size()},
+            {"preprocessedBytes", inflation(node)},
+            {"inflates", inflated}
+        });
+    }
+    
+    uint64_t totalBytes = 0;
+    uint64_t totalLines = 0;
+    json unitList = json::array();
+    for (size_t i = 0; i < translationUnits.size(); ++i) {
+        const auto node = translationUnits[i];
+        const auto& cost = costOf(node);
+        totalBytes += cost.bytes;
+        totalLines += cost.lines;
+        if (i >= limit) continue;
+        
+        // 이 .cpp 를 가장 무겁게 만드는 직접 include
+        std::vector<std::pair<uint64_t, IncludeGraph::NodeId>> direct;
+        for (auto include : graph.directIncludes(node)) {
+            uint64_t bytes = slot.count(include) ? costOf(include).bytes
+                                                 : graph.transitiveIncludes(include).bytes + graph.fileBytes(include);
+            direct.emplace_back(bytes, include);
+        }
+        std::sort(direct.rbegin(), direct.rend());
+        json heaviest = json::array();
+        for (size_t k = 0; k < direct.size() && k < 3; ++k) {
+            heaviest.push_back({{"file", graph.path(direct[k].second)}, {"transitiveBytes", direct[k].first}});
+        }
+        
+        unitList.push_back({
+            {"file", graph.path(node)},
+            {"transitiveIncludes", cost.includes},
+            {"transitiveBytes", cost.bytes},
+            {"transitiveLines", cost.lines},
+            {"heaviestIncludes", heaviest}
+        });
+    }
+    
+    return {
+        {"headers", headerList},
+        {"translationUnits", unitList},
+        {"totals", {
+            {"projectHeaders", headers.size()},
+            {"translationUnits", translationUnits.size()},
+            {"preprocessedBytes", totalBytes},
+            {"preprocessedLines", totalLines}
+        }},
+        {"graph", graph.stats()},
+        {"seconds", std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count()}
+    };
+}
+
+json UnrealEngineAnalyzer::unityBuildPlan(size_t maxUnityBytes) {
+    UNREAL_TRACE_SPAN("unityBuildPlan", "analyzer", 0);
+    auto started = std::chrono::steady_clock::now();
+    
+    std::lock_guard<std::mutex> lock(includeGraphMutex_);
+    auto& graph = includeGraph();
+    const std::string projectPrefix = projectPath_ + "/";
+    
+    std::vector<IncludeGraph::NodeId> units;
+    for (IncludeGraph::NodeId node = 0; node < graph.nodeCount(); ++node) {
+        std::string_view path = graph.path(node);
+        if (path.compare(0, projectPrefix.size(), projectPrefix) == 0 && isTranslationUnit(path)) units.push_back(node);
+    }
+    
+    // 번역 단위마다 전이 include 집합과 비용
+    std::vector<std::vector<IncludeGraph::NodeId>> closures(units.size());
+    const size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    auto costs = graph.closureCosts(units, workers, [&](size_t unit, IncludeGraph::NodeId include) {
+        closures[unit].push_back(include);
+    });
+    
+    // MinHash 서명: 집합의 합집합 서명은 원소별 min 이라 묶음이 커져도 서명 하나로 유사도를 추정
+    std::vector<uint32_t> nodeHashes(graph.nodeCount() * UnitySignatureSize);
+    for (IncludeGraph::NodeId node = 0; node < graph.nodeCount(); ++node) {
+        for (size_t k = 0; k < UnitySignatureSize; ++k) nodeHashes[node * UnitySignatureSize + k] = minHashOf(node, k);
+    }
+    std::vector<UnitySignature> signatures(units.size());
+    parallelFor(units.size(), workers, [&](size_t unit) {
+        auto& signature = signatures[unit];
+        signature.fill(UINT32_MAX);
+        for (auto include : closures[unit]) {
+            const uint32_t* hashes = &nodeHashes[include * UnitySignatureSize];
+            for (size_t k = 0; k < UnitySignatureSize; ++k) signature[k] = std::min(signature[k], hashes[k]);
+        }
+    });
+    
+    // 묶음의 실제 전처리 바이트 = 각 .cpp 자신 + 전이 include 합집합 (공유 헤더는 한 번만)
+    std::vector<uint32_t> stamp(graph.nodeCount(), 0);
+    uint32_t stampGeneration = 0;
+    auto groupBytes = [&](const std::vector<size_t>& group) {
+        ++stampGeneration;
+        uint64_t bytes = 0;
+        for (auto unit : group) {
+            bytes += graph.fileBytes(units[unit]);
+            for (auto include : closures[unit]) {
+                if (stamp[include] == stampGeneration) continue;
+                stamp[include] = stampGeneration;
+                bytes += graph.fileBytes(include);
+            }
+        }
+        return bytes;
+    };
+    
+    std::map<std::string, std::vector<size_t>> modules;
+    for (size_t unit = 0; unit < units.size(); ++unit) {
+        modules[IndexScheduler::moduleRootOf(std::string(graph.path(units[unit])))].push_back(unit);
+    }
+    
+    uint64_t separateBytes = 0, alphabeticalBytes = 0, proposedBytes = 0;
+    size_t groupCount = 0;
+    json moduleList = json::array();
+    for (auto& [moduleRoot, members] : modules) {
+        // UBT 기본 동작: 경로 순으로 채우다가 소스 바이트가 한도를 넘으면 새 묶음
+        std::sort(members.begin(), members.end(), [&](size_t a, size_t b) { return graph.path(units[a]) < graph.path(units[b]); });
+        uint64_t moduleAlphabetical = 0;
+        std::vector<size_t> chunk;
+        uint64_t chunkSource = 0;
+        for (auto unit : members) {
+            separateBytes += costs[unit].bytes + graph.fileBytes(units[unit]);
+            if (!chunk.empty() && chunkSource + graph.fileBytes(units[unit]) > maxUnityBytes) {
+                moduleAlphabetical += groupBytes(chunk);
+                chunk.clear();
+                chunkSource = 0;
+            }
+            chunk.push_back(unit);
+            chunkSource += graph.fileBytes(units[unit]);
+        }
+        if (!chunk.empty()) moduleAlphabetical += groupBytes(chunk);
+        
+        // LSH: 서명을 밴드로 잘라 같은 버킷에 들어간 .cpp 만 후보로 (버킷이 비면 모듈 전체)
+        std::unordered_map<uint64_t, std::vector<size_t>> buckets;
+        auto bucketKey = [&](size_t unit, size_t band) {
+            uint64_t key = band;
+            for (size_t k = band * UnityBandRows; k < (band + 1) * UnityBandRows; ++k) key = key * 0x100000001B3ull ^ signatures[unit][k];
+            return key;
+        };
+        for (auto unit : members) {
+            for (size_t band = 0; band < UnitySignatureSize / UnityBandRows; ++band) buckets[bucketKey(unit, band)].push_back(unit);
+        }
+        
+        // 탐욕적 군집: 가장 무거운 .cpp 에서 시작해 공유 바이트 추정치가 가장 큰 후보를 한도까지 추가
+        std::vector<size_t> byWeight = members;
+        std::sort(byWeight.begin(), byWeight.end(), [&](size_t a, size_t b) {
+            if (costs[a].bytes != costs[b].bytes) return costs[a].bytes > costs[b].bytes;
+            return a < b;
+        });
+        std::unordered_set<size_t> ungrouped(members.begin(), members.end());
+        json groupList = json::array();
+        uint64_t moduleProposed = 0;
+        for (auto seed : byWeight) {
+            if (!ungrouped.erase(seed)) continue;
+            std::vector<size_t> group{seed};
+            UnitySignature unionSignature = signatures[seed];
+            uint64_t sourceBytes = graph.fileBytes(units[seed]);
+            uint64_t unionEstimate = costs[seed].bytes;
+            
+            // 후보 풀은 묶음에 들어온 .cpp 의 버킷 동료를 한 번씩만 더함
+            std::unordered_set<size_t> pool;
+            auto addBucketMates = [&](size_t member) {
+                for (size_t band = 0; band < UnitySignatureSize / UnityBandRows; ++band) {
+                    for (auto other : buckets[bucketKey(member, band)]) {
+                        if (ungrouped.count(other)) pool.insert(other);
+                    }
+                }
+            };
+            addBucketMates(seed);
+            
+            while (!ungrouped.empty()) {
+                for (auto it = pool.begin(); it != pool.end(); ) {
+                    it = ungrouped.count(*it) ? std::next(it) : pool.erase(it);
+                }
+                const auto& candidates = pool.empty() ? ungrouped : pool;
+                
+                size_t best = SIZE_MAX;
+                double bestShared = 0.0;
+                for (auto candidate : candidates) {
+                    if (sourceBytes + graph.fileBytes(units[candidate]) > maxUnityBytes) continue;
+                    // |A ∩ B| ≈ J / (1 + J) * (|A| + |B|)
+                    double similarity = estimatedJaccard(unionSignature, signatures[candidate]);
+                    double shared = similarity / (1.0 + similarity) * static_cast<double>(unionEstimate + costs[candidate].bytes);
+                    if (shared > bestShared || (shared == bestShared && best != SIZE_MAX && candidate < best)) {
+                        best = candidate;
+                        bestShared = shared;
+                    }
+                }
+                if (best == SIZE_MAX) break;
+                
+                ungrouped.erase(best);
+                group.push_back(best);
+                addBucketMates(best);
+                sourceBytes += graph.fileBytes(units[best]);
+                unionEstimate += costs[best].bytes - static_cast<uint64_t>(bestShared);
+                for (size_t k = 0; k < UnitySignatureSize; ++k) unionSignature[k] = std::min(unionSignature[k], signatures[best][k]);
+            }
+            
+            uint64_t separate = 0;
+            json files = json::array();
+            std::sort(group.begin(), group.end(), [&](size_t a, size_t b) { return graph.path(units[a]) < graph.path(units[b]); });
+            for (auto unit : group) {
+                separate += costs[unit].bytes + graph.fileBytes(units[unit]);
+                files.push_back(graph.path(units[unit]));
+            }
+            const uint64_t preprocessed = groupBytes(group);
+            moduleProposed += preprocessed;
+            groupList.push_back({
+                {"files", files},
+                {"sourceBytes", sourceBytes},
+                {"preprocessedBytes", preprocessed},
+                {"sharedBytes", separate - preprocessed}
+            });
+        }
+        
+        alphabeticalBytes += moduleAlphabetical;
+        proposedBytes += moduleProposed;
+        groupCount += groupList.size();
+        moduleList.push_back({
+            {"module", moduleRoot},
+            {"translationUnits", members.size()},
+            {"alphabeticalBytes", moduleAlphabetical},
+            {"proposedBytes", moduleProposed},
+            {"groups", groupList}
+        });
+    }
+    
+    return {
+        {"maxUnityBytes", maxUnityBytes},
+        {"modules", moduleList},
+        {"totals", {
+            {"translationUnits", units.size()},
+            {"groups", groupCount},
+            {"separateBytes", separateBytes},
+            {"alphabeticalBytes", alphabeticalBytes},
+            {"proposedBytes", proposedBytes},
+            {"savedBytes", alphabeticalBytes > proposedBytes ? alphabeticalBytes - proposedBytes : 0}
+        }},
+        {"graph", graph.stats()},
+        {"seconds", std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count()}
+    };
+}
+
+json UnrealEngineAnalyzer::pchCandidates(double minFraction, size_t limit) {
+    UNREAL_TRACE_SPAN("pchCandidates", "analyzer", 0);
+    auto started = std::chrono::steady_clock::now();
+    
+    std::lock_guard<std::mutex> lock(includeGraphMutex_);
+    auto& graph = includeGraph();
+    const std::string projectPrefix = projectPath_ + "/";
+    
+    // 모듈마다 헤더 행 x 번역 단위 열의 비트셋 (행 = 그 헤더를 전이적으로 끌어오는 .cpp)
+    struct ModuleRows {
+        std::string root;
+        std::vector<IncludeGraph::NodeId> units;
+        size_t words = 0;
+        std::unordered_map<IncludeGraph::NodeId, uint32_t> rowOf;
+        std::vector<IncludeGraph::NodeId> headers;
+        std::vector<uint64_t> bits;
+        
+        size_t count(uint32_t row) const {
+            size_t total = 0;
+            for (size_t k = 0; k < words; ++k) total += static_cast<size_t>(__builtin_popcountll(bits[row * words + k]));
+            return total;
+        }
+    };
+    std::vector<ModuleRows> modules;
+    std::unordered_map<std::string, size_t> moduleIndex;
+    std::vector<IncludeGraph::NodeId> units;
+    std::vector<std::pair<size_t, uint32_t>> columnOf;       // 번역 단위 -> (모듈, 열)
+    for (IncludeGraph::NodeId node = 0; node < graph.nodeCount(); ++node) {
+        std::string_view path = graph.path(node);
+        if (path.compare(0, projectPrefix.size(), projectPrefix) != 0 || !isTranslationUnit(path)) continue;
+        auto root = IndexScheduler::moduleRootOf(std::string(path));
+        auto [it, inserted] = moduleIndex.emplace(root, modules.size());
+        if (inserted) {
+            modules.emplace_back();
+            modules.back().root = root;
+        }
+        auto& module = modules[it->second];
+        units.push_back(node);
+        columnOf.emplace_back(it->second, static_cast<uint32_t>(module.units.size()));
+        module.units.push_back(node);
+    }
+    for (auto& module : modules) module.words = (module.units.size() + 63) / 64;
+    
+    const size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    graph.closureCosts(units, workers, [&](size_t unit, IncludeGraph::NodeId include) {
+        if (isTranslationUnit(graph.path(include))) return;
+        auto& module = modules[columnOf[unit].first];
+        auto [it, inserted] = module.rowOf.emplace(include, static_cast<uint32_t>(module.headers.size()));
+        if (inserted) {
+            module.headers.push_back(include);
+            module.bits.resize(module.bits.size() + module.words, 0);
+        }
+        const uint32_t column = columnOf[unit].second;
+        module.bits[it->second * module.words + column / 64] |= uint64_t{1} << (column % 64);
+    });
+    
+    static const std::regex pchPattern(R"re((?:PrivatePCHHeaderFile|SharedPCHHeaderFile)\s*=\s*"([^"]+)")re");
+    json moduleList = json::array();
+    for (auto& module : modules) {
+        // Build.cs 에 지정된 PCH 와 그 닫힘은 이미 한 번만 파싱됨
+        std::optional<IncludeGraph::NodeId> pch;
+        std::vector<bool> inPch(graph.nodeCount(), false);
+        const std::string moduleName = fs::path(module.root).filename().string();
+        std::ifstream buildFile(module.root + "/" + moduleName + ".Build.cs");
+        if (buildFile) {
+            std::string content((std::istreambuf_iterator<char>(buildFile)), std::istreambuf_iterator<char>());
+            std::smatch match;
+            if (std::regex_search(content, match, pchPattern)) {
+                pch = graph.find(module.root + "/" + match[1].str());
+                if (!pch) pch = graph.resolve(module.units.front(), match[1].str());
+            }
+        }
+        if (pch) {
+            inPch[*pch] = true;
+            for (auto node : graph.transitiveIncludes(*pch).nodes) inPch[node] = true;
+        }
+        
+        // 한 번 파싱으로 줄어드는 양: (그 헤더를 보는 .cpp 수 - 1) x 헤더 크기
+        auto savedBytes = [&](IncludeGraph::NodeId node) -> uint64_t {
+            auto it = module.rowOf.find(node);
+            if (it == module.rowOf.end() || inPch[node]) return 0;
+            return (module.count(it->second) - 1) * graph.fileBytes(node);
+        };
+        
+        const double threshold = std::max(2.0, minFraction * static_cast<double>(module.units.size()));
+        std::vector<IncludeGraph::NodeId> frequent;
+        std::vector<bool> isFrequent(graph.nodeCount(), false);
+        for (uint32_t row = 0; row < module.headers.size(); ++row) {
+            auto node = module.headers[row];
+            std::string_view path = graph.path(node);
+            if (inPch[node] || static_cast<double>(module.count(row)) < threshold ||
+                (path.size() > 12 && path.compare(path.size() - 12, 12, ".generated.h") == 0)) continue;
+            frequent.push_back(node);
+            isFrequent[node] = true;
+        }
+        
+        // 다른 후보의 닫힘에 이미 들어 있는 헤더는 그 후보를 PCH 에 넣으면 따라오므로 가장 바깥 것만 제안
+        struct Candidate {
+            IncludeGraph::NodeId node;
+            size_t units;
+            uint64_t transitiveBytes;
+            uint64_t savedBytes;
+        };
+        // 모듈 번역 단위에서 시작한 DFS 의 역후위 순서는 include 하는 쪽이 먼저 (순환은 먼저 들어간 쪽이 대표)
+        std::vector<IncludeGraph::NodeId> order;
+        std::vector<bool> visited(graph.nodeCount(), false);
+        struct Frame {
+            IncludeGraph::NodeId node;
+            std::vector<IncludeGraph::NodeId> includes;
+            size_t next = 0;
+        };
+        std::vector<Frame> stack;
+        for (auto unit : module.units) {
+            if (visited[unit]) continue;
+            visited[unit] = true;
+            stack.push_back({unit, graph.directIncludes(unit)});
+            while (!stack.empty()) {
+                auto& frame = stack.back();
+                if (frame.next < frame.includes.size()) {
+                    auto include = frame.includes[frame.next++];
+                    if (!visited[include]) {
+                        visited[include] = true;
+                        stack.push_back({include, graph.directIncludes(include)});
+                    }
+                    continue;
+                }
+                order.push_back(frame.node);
+                stack.pop_back();
+            }
+        }
+        
+        // 아직 덮이지 않은 자주 쓰는 헤더가 후보가 되고 그 닫힘을 덮음
+        std::vector<Candidate> candidates;
+        std::unordered_map<IncludeGraph::NodeId, IncludeGraph::Closure> closures;
+        std::vector<bool> covered(graph.nodeCount(), false);
+        for (auto it = order.rbegin(); it != order.rend(); ++it) {
+            const auto node = *it;
+            if (!isFrequent[node] || covered[node]) continue;
+            auto closure = graph.transitiveIncludes(node);
+            covered[node] = true;
+            for (auto include : closure.nodes) covered[include] = true;
+            closures.emplace(node, std::move(closure));
+            Candidate candidate{node, module.count(module.rowOf.at(node)), graph.fileBytes(node), savedBytes(node)};
+            for (auto include : closures[node].nodes) {
+                if (inPch[include]) continue;
+                candidate.transitiveBytes += graph.fileBytes(include);
+                candidate.savedBytes += savedBytes(include);
+            }
+            candidates.push_back(candidate);
+        }
+        if (candidates.empty()) continue;
+        
+        // 모듈 합계는 후보 닫힘의 합집합으로 (후보끼리 겹치는 헤더를 두 번 세지 않음)
+        uint64_t moduleSaved = 0;
+        std::vector<bool> counted(graph.nodeCount(), false);
+        for (const auto& candidate : candidates) {
+            auto add = [&](IncludeGraph::NodeId node) {
+                if (counted[node]) return;
+                counted[node] = true;
+                moduleSaved += savedBytes(node);
+            };
+            add(candidate.node);
+            for (auto include : closures[candidate.node].nodes) add(include);
+        }
+        
+        std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+            if (a.savedBytes != b.savedBytes) return a.savedBytes > b.savedBytes;
+            return a.node < b.node;
+        });
+        json candidateList = json::array();
+        for (size_t i = 0; i < candidates.size() && i < limit; ++i) {
+            const auto& candidate = candidates[i];
+            candidateList.push_back({
+                {"file", graph.path(candidate.node)},
+                {"translationUnits", candidate.units},
+                {"fraction", static_cast<double>(candidate.units) / module.units.size()},
+                {"transitiveBytes", candidate.transitiveBytes},
+                {"estimatedSavedBytes", candidate.savedBytes}
+            });
+        }
+        
+        moduleList.push_back({
+            {"module", module.root},
+            {"translationUnits", module.units.size()},
+            {"pch", pch ? json(graph.path(*pch)) : json(nullptr)},
+            {"candidates", candidateList},
+            {"estimatedSavedBytes", moduleSaved}
+        });
+    }
+    
+    std::sort(moduleList.begin(), moduleList.end(), [](const json& a, const json& b) {
+        return a["estimatedSavedBytes"].get<uint64_t>() > b["estimatedSavedBytes"].get<uint64_t>();
+    });
+    return {
+        {"minFraction", minFraction},
+        {"modules", moduleList},
+        {"graph", graph.stats()},
+        {"seconds", std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count()}
+    };
+}
+
+namespace {
+
+// UHT 가 UFUNCTION 에서 파생시키는 이름 (BlueprintNativeEvent / RPC 구현, WithValidation)
+const char* const GeneratedFunctionSuffixes[] = {"_Implementation", "_Validate"};
+
+bool isValidIdentifier(std::string_view name) {
+    if (name.empty() || std::isdigit(static_cast<unsigned char>(name.front()))) return false;
+    return std::all_of(name.begin(), name.end(), isIdentifierChar);
+}
+
+// AMyActor -> MyActor (리플렉션 경로와 CoreRedirects 는 접두사 없는 이름)
+std::string withoutTypePrefix(const std::string& name) {
+    if (name.size() > 1 && std::strchr("AUFESIT", name[0]) && std::isupper(static_cast<unsigned char>(name[1]))) {
+        return name.substr(1);
+    }
+    return name;
+}
+
+// 선언 바로 위 몇 줄에 리플렉션 매크로가 있는지 (UCLASS / UFUNCTION)
+bool hasReflectionMacro(const std::string& filePath, int declarationLine, std::string_view macro) {
+    std::ifstream in(filePath);
+    std::string line;
+    for (int current = 0; current <= declarationLine && std::getline(in, line); ++current) {
+        if (current >= declarationLine - 3 && line.find(macro) != std::string::npos) return true;
+    }
+    return false;
+}
+
+} // namespace
+
+UnrealEngineAnalyzer::RenameTarget UnrealEngineAnalyzer::renameTarget(const std::string& text, int line, int character) {
+    RenameTarget target;
+    TextDocument document;
+    document.setText(text);
+    if (line < 0 || static_cast<size_t>(line) >= document.lineOffsets.size()) {
+        target.error = "No symbol at the cursor";
+        return target;
+    }
+    size_t offset = document.offsetAt(line, character);
+    size_t begin = offset;
+    while (begin > 0 && isIdentifierChar(text[begin - 1])) --begin;
+    size_t end = offset;
+    while (end < text.size() && isIdentifierChar(text[end])) ++end;
+    if (begin == end || std::isdigit(static_cast<unsigned char>(text[begin]))) {
+        target.error = "No symbol at the cursor";
+        return target;
+    }
+    const std::string word = text.substr(begin, end - begin);
+    target.line = line;
+    target.character = utf16Column(text, document.lineOffsets[line], begin);
+    
+    // 프로젝트 (Source + 프로젝트 플러그인) 인덱스와 엔진 쪽 인덱스
+    std::vector<DynamicHeaderScanner*> projectScanners = {&autoComplete_->projectScanner()};
+    std::vector<DynamicHeaderScanner*> engineScanners = {&engineIndex()->scanner()};
+    auto shards = autoComplete_->pluginShards();
+    for (const auto& shard : shards) {
+        bool projectPlugin = shard->descriptor().rootPath.compare(0, projectPath_.size() + 1, projectPath_ + "/") == 0;
+        (projectPlugin ? projectScanners : engineScanners).push_back(&shard->scanner());
+    }
+    auto declarations = [](const std::vector<DynamicHeaderScanner*>& scanners, const std::string& name) {
+        std::vector<SymbolRecord> found;
+        for (auto* scanner : scanners) {
+            for (const auto& record : scanner->symbolsNamed(InternedString(name).id())) {
+                if ((record.flags & SymbolFlags::Generated) == 0 &&
+                    (record.kind == SymbolKind::Class || record.kind == SymbolKind::Function || record.kind == SymbolKind::Property)) {
+                    found.push_back(record);
+                }
+            }
+        }
+        return found;
+    };
+    
+    // Foo_Implementation 위에서 불렀으면 UFUNCTION Foo 를 바꿈
+    std::vector<SymbolRecord> found;
+    for (const char* suffix : GeneratedFunctionSuffixes) {
+        const size_t length = std::strlen(suffix);
+        if (word.size() > length && word.compare(word.size() - length, length, suffix) == 0) {
+            found = declarations(projectScanners, word.substr(0, word.size() - length));
+            if (!found.empty()) target.name = word.substr(0, word.size() - length);
+        }
+    }
+    if (found.empty()) {
+        found = declarations(projectScanners, word);
+        target.name = word;
+    }
+    
+    if (found.empty()) {
+        target.error = declarations(engineScanners, word).empty()
+            ? "'" + word + "' is not an indexed project class, function or UPROPERTY"
+            : "'" + word + "' is declared in the engine and cannot be renamed";
+        return target;
+    }
+    if (found.front().kind != SymbolKind::Class && !declarations(engineScanners, target.name).empty()) {
+        target.error = "'" + target.name + "' also names an engine declaration (an override would stop overriding)";
+        return target;
+    }
+    
+    // 이름만으로 찾으므로 서로 다른 클래스의 같은 이름 멤버는 구분할 수 없음
+    std::vector<SymbolId> owners;
+    for (const auto& record : found) owners.push_back(record.owner);
+    std::sort(owners.begin(), owners.end());
+    owners.erase(std::unique(owners.begin(), owners.end()), owners.end());
+    if (owners.size() > 1) {
+        std::string classes;
+        for (auto owner : owners) classes += (classes.empty() ? "" : ", ") + InternedString::fromId(owner).str();
+        target.error = "'" + target.name + "' is declared in several project classes (" + classes + ")";
+        return target;
+    }
+    target.declaration = found.front();
+    
+    if (target.declaration.kind == SymbolKind::Function) {
+        for (const char* suffix : GeneratedFunctionSuffixes) {
+            for (auto* scanner : projectScanners) {
+                auto derived = scanner->symbolsNamed(InternedString(target.name + suffix).id());
+                if (std::any_of(derived.begin(), derived.end(), [&](const SymbolRecord& record) {
+                        return record.owner == target.declaration.owner;
+                    })) {
+                    target.suffixes.push_back(suffix);
+                    break;
+                }
+            }
+        }
+    }
+    return target;
+}
+
+// 멤버 이름 앞의 한정자: ->Name, .Name 은 수신 식의 선언 타입이 Owner 나 그 파생 클래스일 때,
+// Owner::Name 은 그 멤버, Other::Name 은 다른 타입. 한정자가 없거나 Super:: / ThisClass:: 이거나
+// 수신 타입을 모르면 이름만으로는 알 수 없음
+enum class MemberUse { Qualified, Foreign, Unqualified };
+
+namespace {
+
+size_t skipSpacesBackward(std::string_view content, size_t end) {
+    while (end > 0 && std::isspace(static_cast<unsigned char>(content[end - 1]))) --end;
+    return end;
+}
+
+std::string_view identifierBefore(std::string_view content, size_t end) {
+    size_t begin = end;
+    while (begin > 0 && isIdentifierChar(content[begin - 1])) --begin;
+    return content.substr(begin, end - begin);
+}
+
+bool isObjectPointerWrapper(std::string_view name) {
+    return name == "TObjectPtr" || name == "TWeakObjectPtr" || name == "TSoftObjectPtr" ||
+           name == "TStrongObjectPtr" || name == "TLazyObjectPtr";
+}
+
+// "TObjectPtr<AMyActor>", "const AMyActor*", "AMyActor&" -> "AMyActor" (모르는 모양이면 빈 문자열)
+std::string_view pointeeType(std::string_view type) {
+    size_t open = type.find('<');
+    if (open != std::string_view::npos) {
+        std::string_view wrapper = type.substr(0, open);
+        while (!wrapper.empty() && std::isspace(static_cast<unsigned char>(wrapper.back()))) wrapper.remove_suffix(1);
+        if (!isObjectPointerWrapper(wrapper)) return {};
+        size_t close = type.rfind('>');
+        if (close == std::string_view::npos || close < open) return {};
+        type = type.substr(open + 1, close - open - 1);
+    }
+    size_t begin = 0;
+    for (;;) {
+        while (begin < type.size() && !isIdentifierChar(type[begin])) ++begin;
+        size_t end = begin;
+        while (end < type.size() && isIdentifierChar(type[end])) ++end;
+        std::string_view word = type.substr(begin, end - begin);
+        if (word != "const" && word != "class" && word != "struct") return word;
+        begin = end;
+    }
+}
+
+// 수신 변수 receiver 가 before 앞에서 마지막으로 선언된 타입 - "AMyActor* Actor", "TObjectPtr<AMyActor> Actor",
+// "FStats& Stats" (선언을 못 찾거나 auto 면 빈 문자열)
+std::string_view declaredTypeOf(std::string_view content, std::string_view receiver, size_t before) {
+    size_t pos = before;
+    while (pos > 0 && (pos = content.rfind(receiver, pos - 1)) != std::string_view::npos) {
+        const size_t end = pos + receiver.size();
+        if ((pos > 0 && isIdentifierChar(content[pos - 1])) || (end < content.size() && isIdentifierChar(content[end]))) {
+            continue;
+        }
+        size_t cursor = skipSpacesBackward(content, pos);
+        while (cursor > 0 && (content[cursor - 1] == '*' || content[cursor - 1] == '&')) {
+            cursor = skipSpacesBackward(content, cursor - 1);
+        }
+        if (identifierBefore(content, cursor) == "const") {
+            cursor = skipSpacesBackward(content, cursor - 5);
+        }
+        if (cursor > 0 && content[cursor - 1] == '>') {
+            size_t open = content.rfind('<', cursor - 1);
+            if (open == std::string_view::npos) continue;
+            if (!isObjectPointerWrapper(identifierBefore(content, skipSpacesBackward(content, open)))) continue;
+            return pointeeType(content.substr(open + 1, cursor - 1 - (open + 1)));
+        }
+        std::string_view type = identifierBefore(content, cursor);
+        if (type.empty() || type == "return" || type == "delete" || type == "new" || type == "throw" ||
+            type == "case" || type == "else" || type == "sizeof" || type == "co_return") {
+            continue;
+        }
+        return type == "auto" ? std::string_view() : type;
+    }
+    return {};
+}
+
+} // namespace
+
+// ownerTypes: Owner 와 그 파생 클래스, memberType: 수신 이름이 클래스 멤버 (UPROPERTY) 일 때의 선언 타입
+static MemberUse memberUseAt(std::string_view content, size_t offset, std::string_view owner,
+                             const std::unordered_set<std::string>& ownerTypes,
+                             const std::function<std::string(std::string_view)>& memberType) {
+    size_t end = skipSpacesBackward(content, offset);
+    size_t access = 0;
+    if (end >= 2 && content.substr(end - 2, 2) == "->") access = 2;
+    else if (end >= 1 && content[end - 1] == '.') access = 1;
+    if (access > 0) {
+        // Stats->Armor 의 Stats 처럼 단순 이름만 - 호출 결과, 연쇄 접근, this 는 타입을 모름
+        size_t receiverEnd = skipSpacesBackward(content, end - access);
+        std::string_view receiver = identifierBefore(content, receiverEnd);
+        size_t receiverBegin = receiverEnd - receiver.size();
+        size_t before = skipSpacesBackward(content, receiverBegin);
+        bool chained = before > 0 && (content[before - 1] == '.' || content[before - 1] == ':' ||
+                                      (before >= 2 && content.substr(before - 2, 2) == "->"));
+        if (receiver.empty() || receiver == "this" || chained || std::isdigit(static_cast<unsigned char>(receiver.front()))) {
+            return MemberUse::Unqualified;
+        }
+        std::string type(declaredTypeOf(content, receiver, receiverBegin));
+        if (type.empty()) type = memberType(receiver);
+        return ownerTypes.count(type) ? MemberUse::Qualified : MemberUse::Unqualified;
+    }
+    if (end < 2 || content.substr(end - 2, 2) != "::") return MemberUse::Unqualified;
+    
+    end = skipSpacesBackward(content, end - 2);
+    std::string_view qualifier = identifierBefore(content, end);
+    if (qualifier == owner) return MemberUse::Qualified;
+    if (qualifier == "Super" || qualifier == "ThisClass") return MemberUse::Unqualified;
+    return MemberUse::Foreign;
+}
+
+json UnrealEngineAnalyzer::prepareRename(const std::string& filePath, const std::string& text, int line, int character) {
+    UNREAL_TRACE_SPAN_DETAIL("prepareRename", "analyzer", filePath);
+    auto target = renameTarget(text, line, character);
+    if (!target.error.empty()) return {{"error", target.error}};
+    
+    const int length = static_cast<int>(target.name.size());
+    return {
+        {"range", {
+            {"start", {{"line", target.line}, {"character", target.character}}},
+            {"end", {{"line", target.line}, {"character", target.character + length}}}
+        }},
+        {"placeholder", target.name}
+    };
+}
+
+json UnrealEngineAnalyzer::rename(const std::string& filePath, const std::string& text, int line, int character,
+                                  const std::string& requestedName,
+                                  const std::unordered_map<std::string, std::string>& openDocuments) {
+    UNREAL_TRACE_SPAN_DETAIL("rename", "analyzer", filePath);
+    auto started = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(renameMutex_);
+    
+    auto target = renameTarget(text, line, character);
+    if (!target.error.empty()) return {{"error", target.error}};
+    
+    // prepareRename 없이 Foo_Implementation 위에서 Bar_Implementation 으로 바꿔도 Foo -> Bar
+    std::string newName = requestedName;
+    for (const auto& suffix : target.suffixes) {
+        if (newName.size() > suffix.size() && newName.compare(newName.size() - suffix.size(), suffix.size(), suffix) == 0) {
+            newName.resize(newName.size() - suffix.size());
+        }
+    }
+    if (!isValidIdentifier(newName)) return {{"error", "'" + newName + "' is not a valid C++ identifier"}};
+    if (newName == target.name) return {{"error", "The new name is the same as the old name"}};
+    
+    const auto& declaration = target.declaration;
+    const bool isClass = declaration.kind == SymbolKind::Class;
+    if (isClass && withoutTypePrefix(target.name) != target.name && newName[0] != target.name[0]) {
+        return {{"error", std::string("UHT requires '") + target.name[0] + "' as the prefix of " + target.name}};
+    }
+    for (const auto& record : autoComplete_->projectScanner().symbolsNamed(InternedString(newName).id())) {
+        if (isClass ? record.kind == SymbolKind::Class : record.owner == declaration.owner) {
+            return {{"error", "'" + newName + "' already exists" +
+                              (isClass ? std::string() : " in " + InternedString::fromId(declaration.owner).str())}};
+        }
+    }
+    
+    // 교차 참조: 프로젝트 Source 와 프로젝트 플러그인의 소스 중 이름이 나오는 파일만
+    std::vector<std::string> files;
+    for (const char* root : {"/Source", "/Plugins"}) {
+        std::error_code ec;
+        for (fs::recursive_directory_iterator it(projectPath_ + root, ec), end; !ec && it != end; it.increment(ec)) {
+            auto extension = it->path().extension();
+            if (it->is_regular_file(ec) && (extension == ".h" || extension == ".cpp" || extension == ".inl")) {
+                files.push_back(it->path().string());
+            }
+        }
+    }
+    const size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    crossReferences_.refresh(files, openDocuments, workers);
+    
+    std::vector<SymbolId> names = {InternedString(target.name).id()};
+    std::unordered_map<SymbolId, std::string> replacements = {{names.front(), newName}};
+    for (const auto& suffix : target.suffixes) {
+        names.push_back(InternedString(target.name + suffix).id());
+        replacements[names.back()] = newName + suffix;
+    }
+    auto mentioning = crossReferences_.filesMentioning(names);
+    
+    // ->Name / .Name 의 수신 타입이 Owner 이거나 프로젝트 안의 파생 클래스인지 보려고 상속 관계를 따라감
+    std::unordered_set<std::string> ownerTypes;
+    if (!isClass) {
+        static const std::regex derivedPattern(
+            R"((?:class|struct)\s+(?:\w+_API\s+)?(\w+)\s*(?:final\s*)?:\s*(?:public|protected|private)?\s*(\w+))");
+        std::vector<std::string> pending = {InternedString::fromId(declaration.owner).str()};
+        ownerTypes.insert(pending.front());
+        while (!pending.empty()) {
+            std::string base = std::move(pending.back());
+            pending.pop_back();
+            for (const auto& path : crossReferences_.filesMentioning({InternedString(base).id()})) {
+                if (!isHeaderFile(path)) continue;
+                std::string content;
+                auto open = openDocuments.find(path);
+                if (open != openDocuments.end()) {
+                    content = open->second;
+                } else {
+                    std::ifstream in(path);
+                    content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+                }
+                for (std::sregex_iterator it(content.begin(), content.end(), derivedPattern), last; it != last; ++it) {
+                    if ((*it)[2].str() == base && ownerTypes.insert((*it)[1].str()).second) {
+                        pending.push_back((*it)[1].str());
+                    }
+                }
+            }
+        }
+    }
+    // 파일 안에 선언이 없는 수신 이름은 프로젝트 UPROPERTY 의 타입으로 - 같은 이름의 타입이 여럿이면 모름
+    auto memberType = [&](std::string_view receiver) {
+        std::string type;
+        for (const auto& record : autoComplete_->projectScanner().symbolsNamed(InternedString(receiver).id())) {
+            if (record.kind != SymbolKind::Property || record.type == StringInterner::EmptyId) continue;
+            std::string candidate(pointeeType(InternedString::fromId(record.type).view()));
+            if (!type.empty() && candidate != type) return std::string();
+            type = std::move(candidate);
+        }
+        return type;
+    };
+    
+    // 멤버는 선언한 클래스의 헤더 / 같은 이름의 소스 밖에서는 Owner:: 나 타입을 아는 수신의 ->, . 로 쓴 곳만 바꾸고,
+    // 나머지 (파생 클래스 안의 사용, 같은 이름의 지역 변수, 타입을 모르는 수신) 는 확인이 필요한 편집으로
+    const std::string declarationPath = InternedString::fromId(declaration.file).str();
+    const std::string owner = isClass ? std::string() : InternedString::fromId(declaration.owner).str();
+    auto declaringFile = [&](const std::string& path) {
+        return path == declarationPath ||
+               (fs::path(path).stem() == fs::path(declarationPath).stem() && fs::path(path).extension() != ".h");
+    };
+    
+    // 파일별 편집 (병렬)
+    std::vector<json> fileEdits(mentioning.size());
+    parallelFor(mentioning.size(), workers, [&](size_t i) {
+        std::string content;
+        auto open = openDocuments.find(mentioning[i]);
+        if (open != openDocuments.end()) {
+            content = open->second;
+        } else {
+            std::ifstream in(mentioning[i]);
+            content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        }
+        const bool nameOnly = isClass || declaringFile(mentioning[i]);
+        json edits = json::array();
+        for (const auto& occurrence : CrossReferenceIndex::occurrences(content, names)) {
+            MemberUse use = nameOnly ? MemberUse::Qualified : memberUseAt(content, occurrence.offset, owner, ownerTypes, memberType);
+            if (use == MemberUse::Foreign) continue;
+            
+            const int length = static_cast<int>(InternedString::fromId(occurrence.name).view().size());
+            json edit = {
+                {"range", {
+                    {"start", {{"line", occurrence.line}, {"character", occurrence.character}}},
+                    {"end", {{"line", occurrence.line}, {"character", occurrence.character + length}}}
+                }},
+                {"newText", replacements.at(occurrence.name)}
+            };
+            if (use == MemberUse::Unqualified) edit["annotationId"] = "unqualifiedUses";
+            edits.push_back(std::move(edit));
+        }
+        fileEdits[i] = std::move(edits);
+    });
+    
+    json changes = json::object();
+    size_t editCount = 0;
+    size_t unqualifiedCount = 0;
+    for (size_t i = 0; i < mentioning.size(); ++i) {
+        if (fileEdits[i].empty()) continue;
+        editCount += fileEdits[i].size();
+        for (const auto& edit : fileEdits[i]) unqualifiedCount += edit.contains("annotationId") ? 1 : 0;
+        changes[pathToUri(mentioning[i])] = std::move(fileEdits[i]);
+    }
+    
+    json result = {
+        {"changes", changes},
+        {"files", changes.size()},
+        {"edits", editCount},
+        {"unqualifiedEdits", unqualifiedCount},
+        {"seconds", std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count()}
+    };
+    
+    // 리플렉션되는 심볼은 기존 블루프린트 / 에셋이 옛 이름을 찾도록 CoreRedirects 를 제안
+    const std::string declarationFile = InternedString::fromId(declaration.file).str();
+    bool reflected = declaration.kind == SymbolKind::Property ||
+                     hasReflectionMacro(declarationFile, declaration.startLine, isClass ? "UCLASS" : "UFUNCTION");
+    if (reflected) {
+        const std::string module = fs::path(IndexScheduler::moduleRootOf(declarationFile)).filename().string();
+        const std::string scriptPath = "/Script/" + module + ".";
+        std::string redirect;
+        if (isClass) {
+            redirect = "+ClassRedirects=(OldName=\"" + scriptPath + withoutTypePrefix(target.name) +
+                       "\",NewName=\"" + scriptPath + withoutTypePrefix(newName) + "\")";
+        } else {
+            redirect = std::string(declaration.kind == SymbolKind::Function ? "+FunctionRedirects" : "+PropertyRedirects") +
+                       "=(OldName=\"" + scriptPath + withoutTypePrefix(InternedString::fromId(declaration.owner).str()) + "." +
+                       target.name + "\",NewName=\"" + newName + "\")";
+        }
+        
+        // Config/DefaultEngine.ini 의 [CoreRedirects] 섹션 (없으면 끝에 추가)
+        const std::string iniPath = projectPath_ + "/Config/DefaultEngine.ini";
+        json suggestion = {{"file", iniPath}, {"entry", redirect}};
+        std::ifstream ini(iniPath);
+        if (ini.is_open()) {
+            std::string iniLine;
+            int lineNumber = 0;
+            int lastLineLength = 0;
+            std::optional<int> section;
+            std::string eol = "\n";    // 파일의 줄 끝 (CRLF 유지)
+            while (std::getline(ini, iniLine)) {
+                if (!iniLine.empty() && iniLine.back() == '\r') {
+                    iniLine.pop_back();
+                    eol = "\r\n";
+                }
+                if (!section && iniLine == "[CoreRedirects]") section = lineNumber;
+                lastLineLength = utf16Column(iniLine, 0, iniLine.size());
+                ++lineNumber;
+            }
+            json position = section ? json{{"line", *section + 1}, {"character", 0}}
+                                    : json{{"line", std::max(0, lineNumber - 1)}, {"character", lastLineLength}};
+            suggestion["edit"] = {
+                {"range", {{"start", position}, {"end", position}}},
+                {"newText", section ? redirect + eol : eol + "[CoreRedirects]" + eol + redirect + eol}
+            };
+        }
+        result["coreRedirect"] = suggestion;
+    }
+    return result;
 }
 
-std::vector<CompileError> CompileErrorInterpreter::analyzeErrors(const std::string& projectPath) {
-    auto errorMessages = extractCompileErrors(projectPath);
-    std::vector<CompileError> errors;
+json UnrealEngineAnalyzer::unusedIncludes(const std::string& filePath) {
+    UNREAL_TRACE_SPAN_DETAIL("unusedIncludes", "analyzer", filePath);
+    auto started = std::chrono::steady_clock::now();
+    waitForIndexing();      // 인덱싱 중이면 아직 모르는 클래스 때문에 쓰는 include 를 지울 수 있음
+    
+    std::vector<std::string> files;
+    if (!filePath.empty()) {
+        files.push_back(filePath);
+    } else {
+        std::error_code ec;
+        for (fs::recursive_directory_iterator it(projectPath_ + "/Source", ec), end; !ec && it != end; it.increment(ec)) {
+            auto extension = it->path().extension();
+            if (it->is_regular_file(ec) && (extension == ".h" || extension == ".cpp")) files.push_back(it->path().string());
+        }
+        std::sort(files.begin(), files.end());
+    }
     
-    for (const auto& message : errorMessages) {
-        auto error = interpretError(message);
-        errors.push_back(error);
+    // 1단계 (병렬): 파일별 include/식별자 사용 - 내용 해시가 같으면 캐시에서
+    std::atomic<size_t> cacheHits{0};
+    auto analyzeFiles = [&](const std::vector<std::string>& paths) {
+        std::vector<std::shared_ptr<const IncludeUsage>> results(paths.size());
+        std::atomic<size_t> next{0};
+        auto work = [&]() {
+            for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < paths.size(); ) {
+                std::ifstream in(paths[i]);
+                if (!in.is_open()) continue;
+                std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+                
+                const uint64_t hash = ParsedHeaderCache::contentHash(content);
+                if (auto cached = includeUsageCache_.get(hash)) {
+                    results[i] = *cached;
+                    cacheHits.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                auto usage = std::make_shared<const IncludeUsage>(IncludeUsage::analyze(content));
+                includeUsageCache_.put(hash, usage, usage->memoryBytes());
+                results[i] = std::move(usage);
+            }
+        };
+        std::vector<std::thread> threads;
+        size_t workers = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), paths.size());
+        for (size_t w = 1; w < workers; ++w) threads.emplace_back(work);
+        work();
+        for (auto& thread : threads) thread.join();
+        return results;
+    };
+    auto usages = analyzeFiles(files);
+    
+    // 헤더 -> 그 헤더가 선언한 클래스 (프로젝트, 엔진, 플러그인 인덱스)
+    std::unordered_map<SymbolId, std::vector<SymbolId>> classesByFile;
+    std::unordered_set<std::string_view> classNames;
+    std::vector<DynamicHeaderScanner*> scanners = {&autoComplete_->projectScanner(), &engineIndex()->scanner()};
+    auto shards = autoComplete_->pluginShards();
+    for (const auto& shard : shards) scanners.push_back(&shard->scanner());
+    for (auto* scanner : scanners) {
+        for (const auto& record : scanner->classDeclarations()) {
+            classesByFile[record.file].push_back(record.name);
+            classNames.insert(InternedString::fromId(record.name).view());
+        }
     }
     
-    return errors;
-}
-
-std::string CompileErrorInterpreter::generateErrorReport(const std::vector<CompileError>& errors) {
-    std::ostringstream report;
+    std::lock_guard<std::mutex> lock(includeGraphMutex_);
+    auto& graph = includeGraph();
     
-    report << "/*\n";
-    report << " * COMPILE ERROR ANALYSIS & SOLUTIONS\n";
-    report << " * Found " << errors.size() << " compile errors\n";
-    report << " * ==========================================\n";
-    report << " */\n\n";
+    // include 대상마다 자신 + 전이 include 노드
+    std::unordered_map<IncludeGraph::NodeId, std::vector<IncludeGraph::NodeId>> closures;
+    auto closureOf = [&](IncludeGraph::NodeId header) -> const std::vector<IncludeGraph::NodeId>& {
+        auto [it, inserted] = closures.try_emplace(header);
+        if (inserted) {
+            it->second = graph.transitiveIncludes(header).nodes;
+            it->second.insert(it->second.begin(), header);
+        }
+        return it->second;
+    };
     
-    for (size_t i = 0; i < errors.size() && i < 20; ++i) {
-        const auto& error = errors[i];
-        
-        report << "// ERROR #" << (i + 1) << " [" << static_cast<int>(error.category) << "]\n";
-        report << "// " << std::string(50, '-') << "\n";
-        report << error.formatSolution() << "\n\n";
+    std::vector<std::optional<IncludeGraph::NodeId>> fileNodes(files.size());
+    std::vector<std::vector<std::optional<IncludeGraph::NodeId>>> targets(files.size());
+    std::unordered_set<IncludeGraph::NodeId> reachable;
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (!usages[i] || !(fileNodes[i] = graph.find(files[i]))) continue;
+        for (const auto& include : usages[i]->includes) {
+            auto target = graph.resolve(*fileNodes[i], include.path);
+            targets[i].push_back(target);
+            if (target) {
+                const auto& closure = closureOf(*target);
+                reachable.insert(closure.begin(), closure.end());
+            }
+        }
     }
     
-    return report.str();
-}
-
-std::vector<std::string> CompileErrorInterpreter::extractCompileErrors(const std::string& projectPath) {
-    std::vector<std::string> errors;
-    
-    // 빌드 로그에서 에러 메시지 추출
-    std::string logPath = projectPath + "/Saved/Logs/UnrealBuildTool.log";
+    // 2단계 (병렬): include 로 닿는 헤더가 선언하는 이름 - 클래스 인덱스에 없는 매크로, 구조체, 열거형, 함수
+    std::vector<IncludeGraph::NodeId> headerNodes(reachable.begin(), reachable.end());
+    std::vector<std::string> headerPaths;
+    for (auto node : headerNodes) headerPaths.emplace_back(graph.path(node));
+    auto headerUsages = analyzeFiles(headerPaths);
+    std::unordered_set<IncludeGraph::NodeId> unreadable, declaring;
+    std::unordered_map<std::string_view, std::vector<IncludeGraph::NodeId>> declaredBy;
+    for (size_t k = 0; k < headerNodes.size(); ++k) {
+        if (!headerUsages[k]) {
+            unreadable.insert(headerNodes[k]);
+            continue;
+        }
+        if (!headerUsages[k]->declares.empty()) declaring.insert(headerNodes[k]);
+        for (const auto& name : headerUsages[k]->declares) {
+            if (!classNames.count(name)) declaredBy[name].push_back(headerNodes[k]);
+        }
+    }
     
-    if (fs::exists(logPath)) {
-        std::ifstream file(logPath);
-        std::string line;
+    json results = json::array();
+    size_t unusedCount = 0;
+    size_t unknownCount = 0;
+    size_t forwardCount = 0;
+    for (size_t i = 0; i < files.size(); ++i) {
+        if (!usages[i] || !fileNodes[i]) continue;
+        const std::string stem = fs::path(files[i]).stem().string();
+        const bool header = isHeaderFile(files[i]);
         
-        while (std::getline(file, line)) {
-            if (line.find("error:") != std::string::npos) {
-                errors.push_back(line);
+        // 이 파일이 직접 include 한 헤더가 선언한 것은 그 include 의 몫
+        std::unordered_set<IncludeGraph::NodeId> directTargets;
+        std::unordered_set<SymbolId> declaredByIncludes;
+        for (const auto& target : targets[i]) {
+            if (!target) continue;
+            directTargets.insert(*target);
+            auto declared = classesByFile.find(graph.file(*target));
+            if (declared != classesByFile.end()) declaredByIncludes.insert(declared->second.begin(), declared->second.end());
+        }
+        // 파일이 쓰는 이름을 선언한 헤더 (클래스 제외)
+        std::unordered_set<IncludeGraph::NodeId> usedHeaders;
+        for (const auto& [name, complete] : usages[i]->identifiers) {
+            auto declaring = declaredBy.find(name);
+            if (declaring != declaredBy.end()) usedHeaders.insert(declaring->second.begin(), declaring->second.end());
+        }
+        
+        json unused = json::array();
+        json unknown = json::array();
+        json forwardDeclarations = json::array();
+        for (size_t k = 0; k < usages[i]->includes.size(); ++k) {
+            const auto& include = usages[i]->includes[k];
+            const auto& target = targets[i][k];
+            if (!target || endsWith(include.path, ".generated.h")) continue;
+            if (fs::path(std::string(graph.path(*target))).stem().string() == stem) continue;   // 짝 헤더
+            
+            // 클래스 외의 선언 (매크로 등) 을 쓰는지, 읽지 못한 헤더가 있는지
+            bool usesOtherNames = false;
+            bool incomplete = false;
+            bool declaresAnything = false;
+            std::vector<SymbolId> provided;
+            for (auto node : closureOf(*target)) {
+                if (unreadable.count(node)) incomplete = true;
+                auto declared = classesByFile.find(graph.file(node));
+                if (declared != classesByFile.end()) {
+                    provided.insert(provided.end(), declared->second.begin(), declared->second.end());
+                }
+                declaresAnything |= declared != classesByFile.end() || declaring.count(node);
+                if (node != *target && directTargets.count(node)) continue;    // 다른 include 가 직접 제공
+                usesOtherNames |= usedHeaders.count(node) > 0;
             }
+            
+            auto declared = classesByFile.find(graph.file(*target));
+            std::vector<std::string> used;
+            bool needsDefinition = false;
+            for (auto name : provided) {
+                bool own = declared != classesByFile.end() &&
+                           std::find(declared->second.begin(), declared->second.end(), name) != declared->second.end();
+                if (!own && declaredByIncludes.count(name)) continue;     // 다른 include 가 직접 제공
+                auto use = usages[i]->identifiers.find(InternedString::fromId(name).str());
+                if (use == usages[i]->identifiers.end()) continue;
+                used.push_back(use->first);
+                needsDefinition |= use->second;
+            }
+            
+            json entry = {{"line", include.line}, {"include", include.path}, {"resolved", graph.path(*target)}};
+            if (used.empty() && !usesOtherNames) {
+                // 무엇을 제공하는지 다 알 때만 지워도 된다고 판단
+                if (incomplete || !declaresAnything) {
+                    unknown.push_back(std::move(entry));
+                } else {
+                    unused.push_back(std::move(entry));
+                }
+            } else if (header && !needsDefinition && !usesOtherNames) {
+                std::sort(used.begin(), used.end());
+                used.erase(std::unique(used.begin(), used.end()), used.end());
+                json declarations = json::array();
+                for (const auto& name : used) declarations.push_back("class " + name + ";");
+                forwardDeclarations.push_back({{"line", include.line}, {"include", include.path},
+                                               {"declarations", declarations}});
+            }
+        }
+        
+        unusedCount += unused.size();
+        unknownCount += unknown.size();
+        forwardCount += forwardDeclarations.size();
+        if (!unused.empty() || !unknown.empty() || !forwardDeclarations.empty()) {
+            results.push_back({{"file", files[i]}, {"unusedIncludes", unused}, {"unknownIncludes", unknown},
+                               {"forwardDeclarations", forwardDeclarations}});
         }
     }
     
-    return errors;
+    return {
+        {"filesAnalyzed", files.size()},
+        {"cacheHits", cacheHits.load()},
+        {"unusedIncludes", unusedCount},
+        {"unknownIncludes", unknownCount},
+        {"forwardDeclarations", forwardCount},
+        {"seconds", std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count()},
+        {"files", results}
+    };
 }
 
-CompileError CompileErrorInterpreter::interpretError(const std::string& errorMessage) {
-    CompileError error;
-    error.message = errorMessage;
-    error.category = ErrorCategory::Unknown;
-    error.confidence = 0.0;
-    error.solution = "Manual investigation required";
+void UnrealEngineAnalyzer::focusDocument(const std::string& filePath, const std::string& text) {
+    UNREAL_TRACE_SPAN_DETAIL("focusDocument", "indexer", filePath);
     
-    for (const auto& pattern : patterns_) {
-        std::smatch match;
-        if (std::regex_search(errorMessage, match, pattern.pattern)) {
-            error.category = pattern.category;
-            error.confidence = pattern.confidence;
-            error.solution = pattern.solution;
-            break;
-        }
+    auto includes = IndexScheduler::parseIncludes(text);
+    if (isHeaderFile(filePath)) includes.push_back(filePath);
+    const std::string moduleRoot = IndexScheduler::moduleRootOf(filePath);
+    
+    autoComplete_->projectScanner().focus(includes, moduleRoot);
+    autoComplete_->engineIndex()->scanner().focus(includes, moduleRoot);
+}
+
+namespace {
+
+// 커서가 있는 줄의 시작부터 커서까지
+std::string_view linePrefix(const std::string& text, int line, int character) {
+    size_t lineStart = 0;
+    for (int i = 0; i < line && lineStart != std::string::npos; ++i) {
+        lineStart = text.find('\n', lineStart);
+        if (lineStart != std::string::npos) ++lineStart;
     }
+    if (lineStart == std::string::npos) return {};
     
-    return error;
+    size_t lineEnd = std::min(text.find('\n', lineStart), text.size());
+    size_t cursor = std::min(lineStart + static_cast<size_t>(std::max(character, 0)), lineEnd);
+    return std::string_view(text).substr(lineStart, cursor - lineStart);
+}
+
+} // namespace
+
+std::string UnrealEngineAnalyzer::getCurrentWord(const std::string& text, int line, int character) {
+    // 커서 바로 앞의 식별자 (입력 중인 접두사)
+    std::string_view prefix = linePrefix(text, line, character);
+    size_t wordStart = prefix.size();
+    while (wordStart > 0 && isIdentifierChar(prefix[wordStart - 1])) --wordStart;
+    return std::string(prefix.substr(wordStart));
+}
+
+std::string UnrealEngineAnalyzer::detectUnrealContext(const std::string& text, int line, int character) {
+    // 입력 중인 단어 앞부분 ("AMyActor::" 등 멤버 접근 판단용)
+    std::string_view prefix = linePrefix(text, line, character);
+    size_t wordStart = prefix.size();
+    while (wordStart > 0 && isIdentifierChar(prefix[wordStart - 1])) --wordStart;
+    return std::string(prefix.substr(0, wordStart));
+}
+
+UnrealClass* UnrealEngineAnalyzer::findClassAtPosition(const std::string& uri, int line) {
+    // 간단한 구현 - 실제로는 AST 파싱 필요
+    return nullptr;
+}
+
+bool UnrealEngineAnalyzer::isHeaderFile(const std::string& uri) {
+    return endsWith(uri, ".h") || endsWith(uri, ".hpp");
+}
+
+bool UnrealEngineAnalyzer::isSourceFile(const std::string& uri) {
+    return endsWith(uri, ".cpp") || endsWith(uri, ".cc");
+}
+
+std::string UnrealEngineAnalyzer::getCorrespondingFile(const std::string& uri) {
+    if (isHeaderFile(uri)) {
+        std::string base = uri.substr(0, uri.find_last_of('.'));
+        return base + ".cpp";
+    } else if (isSourceFile(uri)) {
+        std::string base = uri.substr(0, uri.find_last_of('.'));
+        return base + ".h";
+    }
+    
+    return "";
 }
 
 // =============================================================================
-// UnrealCodeGenerator 구현
+// TextDocument 구현
 // =============================================================================
 
-std::string UnrealCodeGenerator::generateUClass(const ClassTemplate& template_) {
-    std::ostringstream ss;
-    
-    ss << "#pragma once\n\n";
-    ss << "#include \"CoreMinimal.h\"\n";
-    ss << "#include \"" << template_.baseClass << ".h\"\n";
-    ss << "#include \"" << template_.className << ".generated.h\"\n\n";
-    
-    ss << "UCLASS(";
-    if (template_.isBlueprintType) ss << "BlueprintType";
-    if (template_.isBlueprintable) {
-        if (template_.isBlueprintType) ss << ", ";
-        ss << "Blueprintable";
+void TextDocument::setText(std::string newText) {
+    text = std::move(newText);
+    lineOffsets.clear();
+    rebuildLineOffsets(0);
+}
+
+void TextDocument::rebuildLineOffsets(size_t fromLine) {
+    // fromLine 이전 줄들의 오프셋은 변경 전과 동일하므로 유지
+    if (fromLine == 0 || lineOffsets.empty()) {
+        lineOffsets.assign(1, 0);
+        fromLine = 0;
+    } else {
+        lineOffsets.resize(std::min(fromLine + 1, lineOffsets.size()));
     }
-    ss << ")\n";
-    
-    ss << "class " << template_.moduleName << "_API " << template_.className;
-    ss << " : public " << template_.baseClass << "\n{\n";
-    ss << "\tGENERATED_BODY()\n\n";
     
-    ss << "public:\n";
-    ss << "\t" << template_.className << "();\n\n";
-    
-    if (template_.baseClass == "AActor" || template_.baseClass == "APawn") {
-        ss << "protected:\n";
-        ss << "\tvirtual void BeginPlay() override;\n\n";
-        ss << "public:\n";
-        ss << "\tvirtual void Tick(float DeltaTime) override;\n\n";
+    for (size_t pos = lineOffsets.back(); pos < text.size(); ++pos) {
+        if (text[pos] == '\n') {
+            lineOffsets.push_back(pos + 1);
+        }
     }
-    
-    for (const auto& component : template_.components) {
-        ss << "\tUPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = \"Components\")\n";
-        ss << "\tclass " << component << "* " << component.substr(1) << "Component;\n\n";
+}
+
+size_t TextDocument::offsetAt(int line, int character) const {
+    if (line < 0) return 0;
+    if (static_cast<size_t>(line) >= lineOffsets.size()) return text.size();
+    
+    size_t lineStart = lineOffsets[line];
+    size_t lineEnd = static_cast<size_t>(line) + 1 < lineOffsets.size() ? lineOffsets[line + 1] : text.size();
+    
+    // LSP의 character는 UTF-16 코드 유닛 기준
+    size_t pos = lineStart;
+    int units = 0;
+    while (pos < lineEnd && units < character && text[pos] != '\n') {
+        unsigned char c = static_cast<unsigned char>(text[pos]);
+        size_t length = c < 0x80 ? 1 : (c >> 5) == 0x6 ? 2 : (c >> 4) == 0xE ? 3 : 4;
+        units += length == 4 ? 2 : 1;
+        pos += length;
     }
     
-    for (const auto& func : template_.customFunctions) {
-        ss << "\tUFUNCTION(BlueprintCallable, Category = \"Gameplay\")\n";
-        ss << "\tvoid " << func << "();\n\n";
+    return std::min(pos, lineEnd);
+}
+
+void TextDocument::applyChange(const json& change) {
+    if (!change.contains("range")) {
+        setText(change.value("text", std::string()));
+        return;
     }
     
-    ss << "};";
+    const auto& range = change["range"];
+    int startLine = range["start"]["line"];
+    size_t start = offsetAt(startLine, range["start"]["character"]);
+    size_t end = offsetAt(range["end"]["line"], range["end"]["character"]);
+    if (end < start) std::swap(start, end);
     
-    return ss.str();
+    text.replace(start, end - start, change.value("text", std::string()));
+    rebuildLineOffsets(static_cast<size_t>(std::max(startLine, 0)));
 }
 
-std::string UnrealCodeGenerator::generateUStruct(const std::string& structName, const std::vector<std::string>& members) {
-    std::ostringstream ss;
+// =============================================================================
+// UnrealMacroDiagnostics 구현
+// =============================================================================
+
+json MacroDiagnostic::toJson() const {
+    return {
+        {"range", {
+            {"start", {{"line", line}, {"character", startCharacter}}},
+            {"end", {{"line", line}, {"character", endCharacter}}}
+        }},
+        {"severity", severity},
+        {"code", code},
+        {"source", "unreal-lsp"},
+        {"message", message}
+    };
+}
+
+namespace {
+
+struct SourceLine {
+    int number;
+    std::string_view content;   // 주석 제거 후 앞뒤 공백을 잘라낸 내용
+    int indent;
+};
+
+// 주석을 제거한 줄 목록 - 문자열 리터럴 안의 '//'는 고려하지 않는 단순 스캔
+std::vector<SourceLine> splitCodeLines(const std::string& text, std::vector<std::string>& storage) {
+    std::vector<SourceLine> lines;
+    bool inBlockComment = false;
+    int lineNumber = 0;
+    size_t pos = 0;
+    
+    storage.clear();
+    storage.reserve(std::count(text.begin(), text.end(), '\n') + 1);
+    
+    while (pos <= text.size()) {
+        size_t eol = text.find('\n', pos);
+        if (eol == std::string::npos) eol = text.size();
+        
+        std::string code;
+        for (size_t i = pos; i < eol; ++i) {
+            if (inBlockComment) {
+                if (text[i] == '*' && i + 1 < eol && text[i + 1] == '/') {
+                    inBlockComment = false;
+                    ++i;
+                }
+                continue;
+            }
+            if (text[i] == '/' && i + 1 < eol && text[i + 1] == '/') break;
+            if (text[i] == '/' && i + 1 < eol && text[i + 1] == '*') {
+                inBlockComment = true;
+                ++i;
+                continue;
+            }
+            code.push_back(text[i] == '\r' ? ' ' : text[i]);
+        }
+        
+        size_t first = code.find_first_not_of(" \t");
+        size_t last = code.find_last_not_of(" \t");
+        storage.push_back(first == std::string::npos ? std::string() : code.substr(first, last - first + 1));
+        lines.push_back({lineNumber, std::string_view(), first == std::string::npos ? 0 : static_cast<int>(first)});
+        
+        ++lineNumber;
+        pos = eol + 1;
+    }
     
-    ss << "USTRUCT(BlueprintType)\n";
-    ss << "struct F" << structName << "\n{\n";
-    ss << "\tGENERATED_USTRUCT_BODY()\n\n";
+    for (size_t i = 0; i < lines.size(); ++i) {
+        lines[i].content = storage[i];
+    }
     
-    for (const auto& member : members) {
-        ss << "\tUPROPERTY(EditAnywhere, BlueprintReadWrite)\n";
-        ss << "\t" << member << ";\n\n";
+    return lines;
+}
+
+bool startsWithWord(std::string_view content, std::string_view word) {
+    if (content.substr(0, word.size()) != word) return false;
+    return content.size() == word.size() || !(std::isalnum(static_cast<unsigned char>(content[word.size()])) || content[word.size()] == '_');
+}
+
+bool isIncludeDirective(std::string_view content) {
+    if (content.empty() || content[0] != '#') return false;
+    size_t directive = content.find_first_not_of(" \t", 1);
+    return directive != std::string_view::npos && startsWithWord(content.substr(directive), "include");
+}
+
+// 여러 줄에 걸친 UCLASS(\n Blueprintable,\n ...) 의 닫는 괄호가 있는 줄
+size_t macroEndLine(const std::vector<SourceLine>& lines, size_t macroLine) {
+    int depth = 0;
+    bool opened = false;
+    for (size_t i = macroLine; i < lines.size(); ++i) {
+        for (char c : lines[i].content) {
+            if (c == '(') { ++depth; opened = true; }
+            else if (c == ')') { --depth; }
+        }
+        if (!opened || depth <= 0) return opened ? i : macroLine;
+    }
+    return lines.size() - 1;
+}
+
+std::string declaredTypeName(std::string_view declaration) {
+    // "class MYGAME_API AMyActor : public AActor" -> "AMyActor"
+    static const std::regex namePattern(R"(^(?:class|struct)\s+(?:\w+_API\s+)?(\w+))");
+    std::match_results<std::string_view::const_iterator> match;
+    if (std::regex_search(declaration.begin(), declaration.end(), match, namePattern)) {
+        return match[1].str();
+    }
+    return "";
+}
+
+} // namespace
+
+std::vector<MacroDiagnostic> UnrealMacroDiagnostics::analyze(const std::string& uri, const std::string& text) const {
+    std::vector<MacroDiagnostic> diagnostics;
+    std::vector<std::string> storage;
+    auto lines = splitCodeLines(text, storage);
+    
+    const bool isHeader = endsWith(uri, ".h") || endsWith(uri, ".hpp");
+    int generatedIncludeLine = -1;
+    int firstReflectedTypeLine = -1;
+    
+    for (size_t i = 0; i < lines.size(); ++i) {
+        const auto& line = lines[i];
+        std::string_view content = line.content;
+        
+        if (isIncludeDirective(content)) {
+            if (generatedIncludeLine >= 0) {
+                diagnostics.push_back({
+                    line.number, line.indent, line.indent + static_cast<int>(content.size()), 1,
+                    "generated-header-not-last",
+                    "#include found after .generated.h file - the .generated.h file should always be the last #include in a header",
+                    ErrorCategory::UnrealMacro
+                });
+            } else if (content.find(".generated.h") != std::string_view::npos) {
+                generatedIncludeLine = line.number;
+            }
+            continue;
+        }
+        
+        const bool isClassMacro = startsWithWord(content, "UCLASS");
+        const bool isStructMacro = startsWithWord(content, "USTRUCT");
+        if (!isClassMacro && !isStructMacro && !startsWithWord(content, "UENUM") && !startsWithWord(content, "UINTERFACE")) {
+            continue;
+        }
+        if (firstReflectedTypeLine < 0) firstReflectedTypeLine = line.number;
+        if (!isClassMacro && !isStructMacro) continue;
+        
+        const std::string_view macroName = isClassMacro ? "UCLASS" : "USTRUCT";
+        const std::string_view keyword = isClassMacro ? "class" : "struct";
+        
+        // 매크로 (닫는 괄호까지) 다음의 첫 코드 줄이 바로 class/struct 선언이어야 함
+        size_t next = macroEndLine(lines, i) + 1;
+        while (next < lines.size() && lines[next].content.empty()) ++next;
+        if (next >= lines.size()) continue;
+        
+        // 전방 선언 (class Foo;) 은 매크로가 붙을 선언이 아님
+        if (!startsWithWord(lines[next].content, keyword) || lines[next].content.back() == ';') {
+            diagnostics.push_back({
+                line.number, line.indent, line.indent + static_cast<int>(content.size()), 1,
+                isClassMacro ? "uclass-not-before-class" : "ustruct-not-before-struct",
+                std::string(macroName) + "() must be the first thing before the " + std::string(keyword) +
+                    " declaration. Move " + std::string(macroName) + "() macro to immediately before " +
+                    std::string(keyword) + " declaration",
+                ErrorCategory::UnrealMacro
+            });
+            continue;
+        }
+        
+        // 클래스 본문 안에서 GENERATED_BODY() 계열 매크로 확인
+        const auto& declaration = lines[next];
+        std::string typeName = declaredTypeName(declaration.content);
+        
+        int depth = 0;
+        bool bodyStarted = false;
+        bool hasGeneratedBody = false;
+        for (size_t j = next; j < lines.size() && !(bodyStarted && depth == 0); ++j) {
+            std::string_view body = lines[j].content;
+            for (char c : body) {
+                if (c == '{') { ++depth; bodyStarted = true; }
+                else if (c == '}') { --depth; }
+            }
+            if (bodyStarted && body.find("GENERATED_") != std::string_view::npos &&
+                body.find("BODY") != std::string_view::npos) {
+                hasGeneratedBody = true;
+                break;
+            }
+        }
+        
+        if (bodyStarted && !hasGeneratedBody) {
+            size_t nameColumn = typeName.empty() ? 0 : declaration.content.find(typeName);
+            int start = declaration.indent + static_cast<int>(nameColumn == std::string_view::npos ? 0 : nameColumn);
+            diagnostics.push_back({
+                declaration.number, start, start + static_cast<int>(typeName.empty() ? declaration.content.size() : typeName.size()), 1,
+                "missing-generated-body",
+                "GENERATED_BODY() not found in " + std::string(macroName) + " '" + typeName +
+                    "'. Add GENERATED_BODY() as first line inside " + std::string(macroName) + " body",
+                ErrorCategory::UnrealMacro
+            });
+        }
     }
     
-    ss << "};";
+    if (isHeader && firstReflectedTypeLine >= 0 && generatedIncludeLine < 0) {
+        std::string stem = fs::path(uri).stem().string();
+        diagnostics.push_back({
+            firstReflectedTypeLine, 0, 0, 1,
+            "missing-generated-include",
+            "Missing #include \"" + stem + ".generated.h\". Add it as the last #include in this header",
+            ErrorCategory::UnrealMacro
+        });
+    }
     
-    return ss.str();
+    return diagnostics;
+}
+
+// =============================================================================
+// 빠른 수정 (textDocument/codeAction) 구현
+// =============================================================================
+
+namespace {
+
+// 진단 하나에 대한 수정 - fix / subject 는 codeAction/resolve 의 data 로 그대로 돌아옴
+struct QuickFix {
+    std::string fix;
+    std::string title;
+    std::string subject;    // 없는 타입, 모듈, 옮길 매크로 이름
+};
+
+std::optional<QuickFix> quickFixFor(const json& diagnostic, const CompileErrorInterpreter& interpreter) {
+    // 이 서버의 매크로 진단은 code 로 구분
+    const std::string code = diagnostic.contains("code") && diagnostic["code"].is_string() ? diagnostic["code"].get<std::string>() : "";
+    if (code == "uclass-not-before-class") return QuickFix{"moveMacro", "Move UCLASS() to the class declaration", "UCLASS"};
+    if (code == "ustruct-not-before-struct") return QuickFix{"moveMacro", "Move USTRUCT() to the struct declaration", "USTRUCT"};
+    if (code == "missing-generated-body") return QuickFix{"insertGeneratedBody", "Insert GENERATED_BODY()", ""};
+    if (code == "missing-generated-include") return QuickFix{"addGeneratedInclude", "Add the .generated.h include", ""};
+    if (code == "generated-header-not-last") return QuickFix{"moveGeneratedInclude", "Move the .generated.h include after the other includes", ""};
+    
+    // 다른 서버(clangd 등)나 빌드 로그의 진단은 해석기 패턴으로 - 패턴은 "error: use of ..." 형태의
+    // 컴파일러 출력 기준이라 "Use of ..." 처럼 대문자로 시작하는 문장은 첫 글자만 낮춤 (UCLASS 등은 유지)
+    std::string message = diagnostic.value("message", "");
+    if (message.compare(0, 6, "error:") != 0) {
+        if (message.size() > 1 && std::isupper(static_cast<unsigned char>(message[0])) &&
+            std::islower(static_cast<unsigned char>(message[1]))) {
+            message[0] = static_cast<char>(std::tolower(static_cast<unsigned char>(message[0])));
+        }
+        message = "error: " + message;
+    }
+    const auto error = interpreter.interpretError(message);
+    switch (error.category) {
+        case ErrorCategory::MissingInclude:
+            // 지역 변수 오타 등은 제외 - 타입 이름만 (실제 선언은 resolve 에서 인덱스로 찾음)
+            if (!error.subject.empty() && std::isupper(static_cast<unsigned char>(error.subject[0]))) {
+                return QuickFix{"addInclude", "Add #include for '" + error.subject + "'", error.subject};
+            }
+            break;
+        case ErrorCategory::ModuleNotFound:
+            return QuickFix{"addModule", "Add '" + error.subject + "' to PublicDependencyModuleNames", error.subject};
+        case ErrorCategory::UnrealMacro:
+            if (message.find("UCLASS() must be the first thing") != std::string::npos) {
+                return QuickFix{"moveMacro", "Move UCLASS() to the class declaration", "UCLASS"};
+            }
+            if (message.find("GENERATED_BODY() not found") != std::string::npos) {
+                return QuickFix{"insertGeneratedBody", "Insert GENERATED_BODY()", ""};
+            }
+            if (message.find("found after .generated.h") != std::string::npos) {
+                return QuickFix{"moveGeneratedInclude", "Move the .generated.h include after the other includes", ""};
+            }
+            break;
+        default:
+            break;
+    }
+    return std::nullopt;
+}
+
+json positionAt(const TextDocument& document, size_t offset) {
+    size_t line = std::upper_bound(document.lineOffsets.begin(), document.lineOffsets.end(), offset) -
+                  document.lineOffsets.begin() - 1;
+    return {{"line", line}, {"character", utf16Column(document.text, document.lineOffsets[line], offset)}};
+}
+
+size_t lineEndOffset(const TextDocument& document, int line) {
+    size_t end = static_cast<size_t>(line) + 1 < document.lineOffsets.size() ? document.lineOffsets[line + 1] : document.text.size();
+    while (end > document.lineOffsets[line] && (document.text[end - 1] == '\n' || document.text[end - 1] == '\r')) --end;
+    return end;
+}
+
+// first..last 줄 원문 (줄 끝 포함 - 마지막 줄에 없으면 붙임)
+std::string rawLines(const TextDocument& document, int first, int last, const std::string& eol) {
+    size_t begin = document.lineOffsets[first];
+    size_t end = static_cast<size_t>(last) + 1 < document.lineOffsets.size() ? document.lineOffsets[last + 1] : document.text.size();
+    std::string lines = document.text.substr(begin, end - begin);
+    if (lines.empty() || lines.back() != '\n') lines += eol;
+    return lines;
+}
+
+// line 앞에 줄 삽입 (line 이 파일 끝을 넘으면 마지막 줄 뒤에)
+json insertLinesEdit(const TextDocument& document, int line, const std::string& lines, const std::string& eol) {
+    json position;
+    std::string newText = lines;
+    if (static_cast<size_t>(line) < document.lineOffsets.size()) {
+        position = {{"line", line}, {"character", 0}};
+    } else {
+        position = positionAt(document, document.text.size());
+        newText = eol + lines.substr(0, lines.size() - eol.size());
+    }
+    return {{"range", {{"start", position}, {"end", position}}}, {"newText", newText}};
+}
+
+json deleteLinesEdit(const TextDocument& document, int first, int last) {
+    json start = {{"line", first}, {"character", 0}};
+    json end = {{"line", last + 1}, {"character", 0}};
+    if (static_cast<size_t>(last) + 1 >= document.lineOffsets.size()) {
+        // 마지막 줄이면 앞 줄 끝부터 지워서 빈 줄이 남지 않도록
+        end = positionAt(document, document.text.size());
+        if (first > 0) start = positionAt(document, lineEndOffset(document, first - 1));
+    }
+    return {{"range", {{"start", start}, {"end", end}}}, {"newText", ""}};
+}
+
+// 새 #include 위치 - 헤더의 .generated.h 는 마지막이어야 하므로 그 앞, 없으면 마지막 #include 다음
+int includeInsertLine(const std::vector<SourceLine>& lines, bool beforeGenerated) {
+    int lastInclude = -1;
+    int pragmaOnce = -1;
+    for (const auto& line : lines) {
+        if (isIncludeDirective(line.content)) {
+            if (beforeGenerated && line.content.find(".generated.h") != std::string_view::npos) return line.number;
+            lastInclude = line.number;
+        } else if (!line.content.empty() && line.content[0] == '#' && line.content.find("pragma") != std::string_view::npos &&
+                   line.content.find("once") != std::string_view::npos) {
+            pragmaOnce = line.number;
+        }
+    }
+    if (lastInclude >= 0) return lastInclude + 1;
+    return pragmaOnce + 1;
 }
 
-std::string UnrealCodeGenerator::generateUFunction(const std::string& functionName, const std::vector<std::string>& parameters) {
-    std::ostringstream ss;
-    
-    ss << "UFUNCTION(BlueprintCallable, Category = \"Gameplay\")\n";
-    ss << "void " << functionName << "(";
-    
-    for (size_t i = 0; i < parameters.size(); ++i) {
-        if (i > 0) ss << ", ";
-        ss << parameters[i];
+// 모듈의 Public / Classes / Private 아래 경로 - UBT 가 모듈마다 넘기는 include 경로 기준
+std::string includeSpelling(const std::string& header) {
+    const std::string root = IndexScheduler::moduleRootOf(header);
+    const std::string rest = header.substr(root.size());
+    for (const char* marker : {"/Public/", "/Classes/", "/Private/", "/Internal/"}) {
+        const size_t length = std::strlen(marker);
+        if (rest.compare(0, length, marker) == 0) return rest.substr(length);
     }
-    
-    ss << ");\n";
-    
-    return ss.str();
+    return fs::path(header).filename().string();
 }
 
-std::string UnrealCodeGenerator::generateUProperty(const std::string& propertyName, const std::string& type) {
-    std::ostringstream ss;
-    
-    ss << "UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = \"Default\")\n";
-    ss << type << " " << propertyName << ";\n";
+std::string buildFileOf(const std::string& moduleRoot) {
+    return moduleRoot + "/" + fs::path(moduleRoot).filename().string() + ".Build.cs";
+}
+
+// Build.cs 의 PublicDependencyModuleNames 에 모듈 추가 - 이미 (Private 포함) 의존하면 nullopt
+std::optional<json> dependencyModuleEdit(const std::string& buildFile, const std::string& module) {
+    std::ifstream file(buildFile);
+    if (!file.is_open()) return std::nullopt;
+    TextDocument document;
+    document.setText(std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>()));
+    const std::string& content = document.text;
+    if (content.find("\"" + module + "\"") != std::string::npos) return std::nullopt;
+    
+    // PublicDependencyModuleNames.AddRange(new string[] { "Core", ... }) 목록 끝에 추가
+    size_t call = content.find("PublicDependencyModuleNames.AddRange(");
+    size_t open = call == std::string::npos ? std::string::npos : content.find('{', call);
+    size_t close = open == std::string::npos ? std::string::npos : content.find('}', open);
+    if (close != std::string::npos) {
+        size_t last = content.find_last_not_of(" \t\r\n", close - 1);
+        const std::string quoted = "\"" + module + "\"";
+        std::string newText = content[last] == '{' || content[last] == ',' ? " " + quoted : ", " + quoted;
+        auto position = positionAt(document, last + 1);
+        return json{{"range", {{"start", position}, {"end", position}}}, {"newText", newText}};
+    }
     
-    return ss.str();
+    // PublicDependencyModuleNames.Add("Core"); 형태면 그 다음 줄에 같은 들여쓰기로
+    call = content.find("PublicDependencyModuleNames.Add(");
+    if (call == std::string::npos) return std::nullopt;
+    const std::string eol = content.find("\r\n") != std::string::npos ? "\r\n" : "\n";
+    int line = positionAt(document, call)["line"];
+    size_t lineStart = document.lineOffsets[line];
+    std::string indent = content.substr(lineStart, content.find_first_not_of(" \t", lineStart) - lineStart);
+    return insertLinesEdit(document, line + 1, indent + "PublicDependencyModuleNames.Add(\"" + module + "\");" + eol, eol);
 }
 
-// =============================================================================
-// VersionCompatibleAutoComplete 구현
-// =============================================================================
+} // namespace
 
-VersionCompatibleAutoComplete::VersionCompatibleAutoComplete(const EngineVersion& version)
-    : engineVersion_(version), headerScanner_(version) {
-    
-    std::thread([this]() {
-        headerScanner_.scanEngineHeaders();
-    }).detach();
+std::optional<SymbolRecord> UnrealEngineAnalyzer::typeDeclaration(const std::string& name) {
+    std::vector<DynamicHeaderScanner*> scanners = {&autoComplete_->projectScanner()};
+    auto shards = autoComplete_->pluginShards();
+    for (const auto& shard : shards) scanners.push_back(&shard->scanner());
+    scanners.push_back(&engineIndex()->scanner());
+    
+    const SymbolId id = InternedString(name).id();
+    for (auto* scanner : scanners) {
+        for (const auto& record : scanner->symbolsNamed(id)) {
+            if ((record.flags & SymbolFlags::Generated) == 0 &&
+                (record.kind == SymbolKind::Class || record.kind == SymbolKind::Struct || record.kind == SymbolKind::Enum)) {
+                return record;
+            }
+        }
+    }
+    return std::nullopt;
 }
 
-std::vector<json> VersionCompatibleAutoComplete::getCompletions(const std::string& prefix, const std::string& context) {
-    std::vector<json> completions;
-    
-    auto macroCompletions = getMacroCompletions(prefix);
-    completions.insert(completions.end(), macroCompletions.begin(), macroCompletions.end());
-    
-    if (context.find("::") != std::string::npos) {
-        auto memberCompletions = getMemberCompletions(context, prefix);
-        completions.insert(completions.end(), memberCompletions.begin(), memberCompletions.end());
+json UnrealEngineAnalyzer::codeActions(const std::string& filePath, const json& diagnostics) {
+    json actions = json::array();
+    std::unordered_set<std::string> seen;
+    for (const auto& diagnostic : diagnostics) {
+        auto fix = quickFixFor(diagnostic, *errorInterpreter_);
+        if (!fix) continue;
+        
+        // 같은 타입 / 모듈이 여러 줄에서 나오면 수정은 하나만
+        const int line = diagnostic.value("/range/start/line"_json_pointer, 0);
+        const bool perLine = fix->fix == "moveMacro" || fix->fix == "insertGeneratedBody";
+        if (!seen.insert(fix->fix + ":" + fix->subject + (perLine ? ":" + std::to_string(line) : "")).second) continue;
+        
+        actions.push_back({
+            {"title", fix->title},
+            {"kind", "quickfix"},
+            {"diagnostics", json::array({diagnostic})},
+            {"isPreferred", true},
+            {"data", {{"fix", fix->fix}, {"subject", fix->subject}, {"uri", pathToUri(filePath)}, {"line", line}}}
+        });
     }
-    
-    return completions;
+    return actions;
 }
 
-std::vector<json> VersionCompatibleAutoComplete::getMacroCompletions(const std::string& prefix) {
-    std::vector<json> completions;
-    
-    std::vector<std::string> macros = {"UCLASS", "USTRUCT", "UFUNCTION", "UPROPERTY", "UENUM"};
-    
-    for (const auto& macro : macros) {
-        if (prefix.empty() || macro.find(prefix) == 0) {
-            json completion;
-            completion["label"] = macro;
-            completion["insertText"] = apiDatabase_.getMacroTemplate(macro, engineVersion_);
-            completion["detail"] = "Unreal Engine " + engineVersion_.toString() + " Macro";
-            completion["kind"] = 15;
-            completion["sortText"] = "0_" + macro;
+json UnrealEngineAnalyzer::resolveCodeAction(json action, const std::string& filePath, const std::string& text) {
+    UNREAL_TRACE_SPAN_DETAIL("resolveCodeAction", "analyzer", filePath);
+    const json data = action.value("data", json::object());
+    const std::string fix = data.value("fix", "");
+    const std::string subject = data.value("subject", "");
+    const std::string uri = pathToUri(filePath);
+    const std::string eol = text.find("\r\n") != std::string::npos ? "\r\n" : "\n";
+    
+    TextDocument document;
+    document.setText(text);
+    std::vector<std::string> storage;
+    const auto lines = splitCodeLines(text, storage);
+    // 빈 파일이면 줄을 가리키는 수정 (moveMacro, insertGeneratedBody) 은 아무것도 찾지 못함
+    const int line = lines.empty() ? -1 : std::clamp(data.value("line", 0), 0, static_cast<int>(lines.size()) - 1);
+    
+    json changes = json::object();
+    auto addEdit = [&changes](const std::string& fileUri, json edit) { changes[fileUri].push_back(std::move(edit)); };
+    
+    if (fix == "addInclude") {
+        auto declaration = typeDeclaration(subject);
+        const std::string header = declaration ? InternedString::fromId(declaration->file).str() : "";
+        if (!header.empty() && header != filePath) {
+            const std::string spelling = includeSpelling(header);
+            if (text.find(spelling + "\"") == std::string::npos) {
+                addEdit(uri, insertLinesEdit(document, includeInsertLine(lines, true), "#include \"" + spelling + "\"" + eol, eol));
+            }
+            // 다른 모듈의 헤더면 이 모듈의 Build.cs 의존성도
+            const std::string headerModule = IndexScheduler::moduleRootOf(header);
+            const std::string fileModule = IndexScheduler::moduleRootOf(filePath);
+            if (headerModule != fileModule) {
+                const std::string buildFile = buildFileOf(fileModule);
+                if (auto edit = dependencyModuleEdit(buildFile, fs::path(headerModule).filename().string())) {
+                    addEdit(pathToUri(buildFile), *edit);
+                }
+            }
+        }
+    } else if (fix == "addModule") {
+        const std::string buildFile = buildFileOf(IndexScheduler::moduleRootOf(filePath));
+        if (auto edit = dependencyModuleEdit(buildFile, subject)) {
+            addEdit(pathToUri(buildFile), *edit);
+        }
+    } else if (fix == "moveMacro") {
+        // 진단 줄에서 위로 매크로를 찾고, 아래쪽 첫 (전방 선언이 아닌) class/struct 선언 바로 앞으로
+        const std::string keyword = subject == "USTRUCT" ? "struct" : "class";
+        int macro = line;
+        while (macro >= 0 && !startsWithWord(lines[macro].content, subject)) --macro;
+        const int macroEnd = macro >= 0 ? static_cast<int>(macroEndLine(lines, macro)) : macro;
+        int declaration = -1;
+        for (int next = macroEnd + 1; macro >= 0 && next < static_cast<int>(lines.size()); ++next) {
+            std::string_view content = lines[next].content;
+            if (startsWithWord(content, keyword) && content.back() != ';') {
+                declaration = next;
+                break;
+            }
+        }
+        int firstCode = macroEnd + 1;
+        while (firstCode < static_cast<int>(lines.size()) && lines[firstCode].content.empty()) ++firstCode;
+        if (declaration > firstCode) {
+            addEdit(uri, deleteLinesEdit(document, macro, macroEnd));
+            addEdit(uri, insertLinesEdit(document, declaration, rawLines(document, macro, macroEnd, eol), eol));
+        }
+    } else if (fix == "insertGeneratedBody") {
+        // 진단 줄에서 위로 선언을 찾고 본문의 '{' 바로 다음에
+        int declaration = line;
+        while (declaration >= 0 && !((startsWithWord(lines[declaration].content, "class") ||
+                                      startsWithWord(lines[declaration].content, "struct")) &&
+                                     lines[declaration].content.back() != ';')) {
+            --declaration;
+        }
+        for (int brace = std::max(declaration, 0); declaration >= 0 && brace < static_cast<int>(lines.size()); ++brace) {
+            size_t column = lines[brace].content.find('{');
+            if (column == std::string_view::npos) continue;
             
-            completions.push_back(completion);
+            const size_t declarationStart = document.lineOffsets[declaration];
+            const std::string indent = text.substr(declarationStart, lines[declaration].indent);
+            const size_t offset = document.lineOffsets[brace] + lines[brace].indent + column + 1;
+            std::string newText = eol + indent + "\tGENERATED_BODY()";
+            if (column + 1 < lines[brace].content.size()) newText += eol + indent + "\t";
+            auto position = positionAt(document, offset);
+            addEdit(uri, {{"range", {{"start", position}, {"end", position}}}, {"newText", newText}});
+            break;
+        }
+    } else if (fix == "addGeneratedInclude") {
+        const std::string generated = fs::path(filePath).stem().string() + ".generated.h";
+        if (text.find(generated) == std::string::npos) {
+            addEdit(uri, insertLinesEdit(document, includeInsertLine(lines, false), "#include \"" + generated + "\"" + eol, eol));
+        }
+    } else if (fix == "moveGeneratedInclude") {
+        int generated = -1;
+        int lastInclude = -1;
+        for (const auto& sourceLine : lines) {
+            if (!isIncludeDirective(sourceLine.content)) continue;
+            if (generated < 0 && sourceLine.content.find(".generated.h") != std::string_view::npos) generated = sourceLine.number;
+            lastInclude = sourceLine.number;
+        }
+        if (generated >= 0 && lastInclude > generated) {
+            addEdit(uri, deleteLinesEdit(document, generated, generated));
+            addEdit(uri, insertLinesEdit(document, lastInclude + 1, rawLines(document, generated, generated, eol), eol));
         }
     }
     
-    return completions;
+    if (changes.empty()) {
+        std::cerr << "⚠️ Quick fix '" << action.value("title", fix) << "' has nothing to change in " << filePath << std::endl;
+        return action;
+    }
+    action["edit"] = {{"changes", changes}};
+    return action;
 }
 
-std::vector<json> VersionCompatibleAutoComplete::getMemberCompletions(const std::string& context, const std::string& prefix) {
-    std::vector<json> completions;
-    
-    size_t pos = context.rfind("::");
-    if (pos == std::string::npos) return completions;
-    
-    std::string className = context.substr(0, pos);
-    size_t lastSpace = className.find_last_of(" \t");
-    if (lastSpace != std::string::npos) {
-        className = className.substr(lastSpace + 1);
-    }
-    
-    auto apiMethods = apiDatabase_.getClassMethods(className, engineVersion_);
-    auto scannedMethods = headerScanner_.getClassMethods(className);
-    
-    std::unordered_set<std::string> allMethods(apiMethods.begin(), apiMethods.end());
-    allMethods.insert(scannedMethods.begin(), scannedMethods.end());
-    
-    for (const auto& method : allMethods) {
-        if (prefix.empty() || method.find(prefix) == 0) {
-            json completion;
-            completion["label"] = method;
-            completion["insertText"] = method;
-            completion["detail"] = className + "::" + method + " (UE " + engineVersion_.toString() + ")";
-            completion["kind"] = 2;
-            completion["sortText"] = "1_" + method;
-            
-            completions.push_back(completion);
+// =============================================================================
+// PeriodicWorker 구현
+// =============================================================================
+
+PeriodicWorker::PeriodicWorker(std::chrono::milliseconds interval, std::function<void()> callback)
+    : interval_(interval), callback_(std::move(callback)) {
+    worker_ = std::thread([this]() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!cv_.wait_for(lock, interval_, [this]() { return stopping_; })) {
+            lock.unlock();
+            try {
+                callback_();
+            } catch (const std::exception& e) {
+                std::cerr << "Background task error: " << e.what() << std::endl;
+            }
+            lock.lock();
         }
+    });
+}
+
+PeriodicWorker::~PeriodicWorker() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
     }
-    
-    return completions;
 }
 
 // =============================================================================
-// UnrealEngineAnalyzer 구현
+// DiagnosticsScheduler 구현
 // =============================================================================
 
-UnrealEngineAnalyzer::UnrealEngineAnalyzer(const std::string& enginePath, const std::string& projectPath)
-    : enginePath_(enginePath), projectPath_(projectPath) {
-    
-    // 프로젝트 엔진 버전 감지
-    UnrealEngineDetector detector;
-    engineVersion_ = detector.detectProjectEngineVersion(projectPath);
-    
-    // 엔진 경로가 비어있으면 감지된 버전의 경로 사용
-    if (enginePath_.empty() && !engineVersion_.installPath.empty()) {
-        enginePath_ = engineVersion_.installPath;
+DiagnosticsScheduler::DiagnosticsScheduler(std::chrono::milliseconds delay, Callback callback)
+    : delay_(delay), callback_(std::move(callback)) {
+    worker_ = std::thread([this]() { workerLoop(); });
+}
+
+DiagnosticsScheduler::~DiagnosticsScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    cv_.notify_all();
+    if (worker_.joinable()) {
+        worker_.join();
     }
-    
-    // 서브시스템들 초기화
-    logAnalyzer_ = std::make_unique<UnrealLogAnalyzer>();
-    errorInterpreter_ = std::make_unique<CompileErrorInterpreter>();
-    headerSourceLinker_ = std::make_unique<HeaderSourceLinker>();
-    blueprintIntegration_ = std::make_unique<BlueprintIntegration>();
-    codeGenerator_ = std::make_unique<UnrealCodeGenerator>();
-    autoComplete_ = std::make_unique<VersionCompatibleAutoComplete>(engineVersion_);
-    
-    // 엔진 include 경로들 설정
-    VersionSpecificAPI apiDB;
-    engineIncludePaths_ = apiDB.getIncludePaths(engineVersion_);
-    
-    startBackgroundIndexing();
 }
 
-std::string UnrealEngineAnalyzer::generateUClassTemplate(const std::string& className, const std::string& baseClass) {
-    ClassTemplate template_;
-    template_.className = className;
-    template_.baseClass = baseClass;
-    template_.moduleName = "GAME";
-    template_.isBlueprintType = true;
-    template_.isBlueprintable = true;
-    
-    return codeGenerator_->generateUClass(template_);
+void DiagnosticsScheduler::schedule(const std::string& uri) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        deadlines_[uri] = std::chrono::steady_clock::now() + delay_;
+    }
+    cv_.notify_all();
 }
 
-std::string UnrealEngineAnalyzer::generateBlueprintFunction(const std::string& uri, int line, int character) {
-    std::lock_guard<std::mutex> lock(dataMutex_);
+void DiagnosticsScheduler::cancel(const std::string& uri) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    deadlines_.erase(uri);
+}
+
+void DiagnosticsScheduler::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
     
-    if (fileFunctions_.count(uri)) {
-        for (const auto& func : fileFunctions_[uri]) {
-            if (func.location.range.start.line <= line && func.location.range.end.line >= line) {
-                return func.generateBlueprintWrapper();
+    while (!stopping_) {
+        if (deadlines_.empty()) {
+            cv_.wait(lock);
+            continue;
+        }
+        
+        auto earliest = std::min_element(deadlines_.begin(), deadlines_.end(),
+            [](const auto& a, const auto& b) { return a.second < b.second; })->second;
+        
+        if (cv_.wait_until(lock, earliest) != std::cv_status::timeout && !stopping_) {
+            continue;   // 새 변경으로 마감 시각이 바뀌었을 수 있으므로 다시 계산
+        }
+        
+        auto now = std::chrono::steady_clock::now();
+        std::vector<std::string> due;
+        static const size_t queueSlot = ServerMetrics::instance().slot("queue/diagnostics");
+        for (auto it = deadlines_.begin(); it != deadlines_.end();) {
+            if (it->second <= now) {
+                // 마감 시각 이후 실제 실행까지 지연 (디바운스 자체는 제외)
+                ServerMetrics::instance().recordLatency(queueSlot, static_cast<uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(now - it->second).count()));
+                due.push_back(it->first);
+                it = deadlines_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        
+        lock.unlock();
+        for (const auto& uri : due) {
+            try {
+                callback_(uri);
+            } catch (const std::exception& e) {
+                std::cerr << "Diagnostics error for " << uri << ": " << e.what() << std::endl;
             }
         }
+        lock.lock();
     }
-    
-    return "// No function found at current position";
 }
 
-std::string UnrealEngineAnalyzer::syncHeaderSource(const std::string& uri) {
-    if (isHeaderFile(uri)) {
-        auto fileInfo = headerSourceLinker_->analyzeFilePair(uri);
-        return headerSourceLinker_->generateMissingImplementations(fileInfo);
-    } else if (isSourceFile(uri)) {
-        return headerSourceLinker_->generateHeaderFromSource(uri);
-    }
-    
-    return "// Unable to sync: not a valid header or source file";
-}
+// =============================================================================
+// LSPServer 구현
+// =============================================================================
 
-std::string UnrealEngineAnalyzer::analyzeUnrealLogs(const std::string& projectPath) {
-    auto issues = logAnalyzer_->analyzeProject(projectPath);
-    return logAnalyzer_->generateAnalysisReport(issues);
+void LSPServer::setMemoryBudget(size_t megabytes) {
+    memoryBudget_.limitBytes.store(megabytes * 1024 * 1024, std::memory_order_relaxed);
+    ParsedHeaderCache::instance().setCapacity(memoryBudget_.cacheBytes());
+    for (const auto& analyzer : allAnalyzers()) {
+        analyzer->applyMemoryBudget(memoryBudget_);
+    }
 }
 
-std::string UnrealEngineAnalyzer::interpretCompileErrors(const std::string& projectPath) {
-    auto errors = errorInterpreter_->analyzeErrors(projectPath);
-    return errorInterpreter_->generateErrorReport(errors);
+void LSPServer::initialize(const std::string& projectPath, const std::string& enginePath) {
+    enginePath_ = enginePath;
+    addWorkspace(projectPath);
+    lastActivity_ = steadyNowMs();
+    
+    // 타이핑 중에는 분석하지 않고 마지막 변경 후 300ms 뒤 한 번만 진단
+    diagnosticsScheduler_ = std::make_unique<DiagnosticsScheduler>(
+        std::chrono::milliseconds(300),
+        [this](const std::string& uri) { publishDiagnostics(uri); });
+    
+    maintenanceWorker_ = std::make_unique<PeriodicWorker>(
+        std::chrono::seconds(5),
+        [this]() { runMaintenance(); });
 }
 
-std::string UnrealEngineAnalyzer::executeCodeAction(const std::string& action, const nlohmann::json& params) {
-    std::string uri = params["textDocument"]["uri"];
-    int line = params["position"]["line"];
-    int character = params["position"]["character"];
-    
-    if (action == "generateUClass") {
-        std::string className = params.value("className", "MyActor");
-        std::string baseClass = params.value("baseClass", "AActor");
-        return generateUClassTemplate(className, baseClass);
-    }
-    else if (action == "generateBlueprintFunction") {
-        return generateBlueprintFunction(uri, line, character);
+bool LSPServer::addWorkspace(const std::string& projectPath) {
+    std::string root = normalizeRoot(projectPath);
+    {
+        std::lock_guard<std::mutex> lock(workspacesMutex_);
+        if (workspaces_.count(root)) return false;
     }
-    else if (action == "syncHeaderSource") {
-        return syncHeaderSource(uri);
-    }
-    else if (action == "analyzeLogs") {
-        return analyzeUnrealLogs(projectPath_);
+    
+    // 분석기 생성(엔진 감지)은 느릴 수 있으므로 잠금 밖에서. 다른 세션이 같은 프로젝트를 열었으면 공유
+    auto analyzer = ProjectAnalyzerRegistry::instance().acquire(enginePath_, root);
+    analyzer->applyMemoryBudget(memoryBudget_);
+    
+    std::lock_guard<std::mutex> lock(workspacesMutex_);
+    if (primaryWorkspace_.empty()) {
+        primaryWorkspace_ = root;
     }
-    else if (action == "interpretErrors") {
-        return interpretCompileErrors(projectPath_);
+    return workspaces_.emplace(root, std::move(analyzer)).second;
+}
+
+void LSPServer::removeWorkspace(const std::string& projectPath) {
+    std::shared_ptr<UnrealEngineAnalyzer> removed;
+    {
+        std::lock_guard<std::mutex> lock(workspacesMutex_);
+        auto it = workspaces_.find(normalizeRoot(projectPath));
+        if (it == workspaces_.end()) return;
+        
+        removed = std::move(it->second);
+        workspaces_.erase(it);
+        if (primaryWorkspace_ == removed->projectPath()) {
+            primaryWorkspace_ = workspaces_.empty() ? "" : workspaces_.begin()->first;
+        }
     }
-    
-    return "// Unknown action: " + action;
+    // 마지막 참조라면 여기서(잠금 밖) 분석기와 공유 엔진 인덱스가 해제
 }
 
-std::vector<CompletionItem> UnrealEngineAnalyzer::getCompletions(
-    const std::string& uri,
-    int line,
-    int character,
-    const std::string& text
-) {
-    std::lock_guard<std::mutex> lock(dataMutex_);
-    
-    std::string currentWord = getCurrentWord(text, line, character);
-    std::string context = detectUnrealContext(text, line, character);
-    
-    std::vector<CompletionItem> completions;
+ProjectAnalyzerRegistry& ProjectAnalyzerRegistry::instance() {
+    static ProjectAnalyzerRegistry registry;
+    return registry;
+}
+
+std::shared_ptr<UnrealEngineAnalyzer> ProjectAnalyzerRegistry::acquire(const std::string& enginePath,
+                                                                       const std::string& projectPath) {
+    const std::string key = projectPath + '|' + enginePath;
+    std::promise<std::shared_ptr<UnrealEngineAnalyzer>> promise;
+    std::shared_future<std::shared_ptr<UnrealEngineAnalyzer>> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& slot = analyzers_[key];
+        if (auto existing = slot.weak.lock()) {
+            slot.unusedSince.reset();
+            return existing;
+        }
+        if (slot.pending.valid()) {
+            pending = slot.pending;
+        } else {
+            slot.pending = promise.get_future().share();
+        }
+    }
+    if (pending.valid()) {
+        return pending.get();       // 다른 세션이 만드는 중 (실패했으면 그 예외)
+    }
     
-    // 버전 호환 자동완성 사용
-    auto jsonCompletions = autoComplete_->getCompletions(currentWord, context);
+    // 엔진 감지, 엔진 인덱스 적재, 백그라운드 인덱싱 시작 - 다른 프로젝트를 여는 세션을 막지 않도록 잠금 밖에서
+    std::shared_ptr<UnrealEngineAnalyzer> analyzer;
+    try {
+        analyzer = std::make_shared<UnrealEngineAnalyzer>(enginePath, projectPath);
+    } catch (...) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            analyzers_[key].pending = {};
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
     
-    for (const auto& jsonCompletion : jsonCompletions) {
-        CompletionItem item;
-        item.label = jsonCompletion["label"];
-        item.insertText = jsonCompletion["insertText"];
-        item.detail = jsonCompletion["detail"];
-        item.kind = jsonCompletion["kind"];
-        item.sortText = jsonCompletion["sortText"];
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto& slot = analyzers_[key];
+        slot.hold(analyzer, retention_.count() > 0);
+        slot.pending = {};
         
-        completions.push_back(item);
+        // 이미 해제된 항목 정리
+        for (auto it = analyzers_.begin(); it != analyzers_.end(); ) {
+            bool unused = !it->second.pending.valid() && !it->second.retained && it->second.weak.expired();
+            it = unused ? analyzers_.erase(it) : std::next(it);
+        }
     }
-    
-    return completions;
+    promise.set_value(analyzer);
+    return analyzer;
 }
 
-void UnrealEngineAnalyzer::startBackgroundIndexing() {
-    // 백그라운드에서 프로젝트 인덱싱 시작
-    std::thread([this]() {
-        // 프로젝트 파일들 스캔 및 인덱싱
-        // 실제 구현에서는 더 복잡한 로직이 필요
-    }).detach();
+void ProjectAnalyzerRegistry::setRetention(std::chrono::steady_clock::duration retention) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    retention_ = retention;
 }
 
-std::string UnrealEngineAnalyzer::getCurrentWord(const std::string& text, int line, int character) {
-    // 간단한 구현 - 실제로는 더 정교한 파싱 필요
-    return "";
+void ProjectAnalyzerRegistry::releaseIdle() {
+    std::vector<std::shared_ptr<UnrealEngineAnalyzer>> released;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto now = std::chrono::steady_clock::now();
+        for (auto it = analyzers_.begin(); it != analyzers_.end(); ) {
+            bool expired = it->second.expire(now, retention_, released) && !it->second.pending.valid();
+            it = expired ? analyzers_.erase(it) : std::next(it);
+        }
+    }
+    for (const auto& analyzer : released) {
+        std::cerr << "🧹 Released idle project " << analyzer->projectPath() << std::endl;
+    }
+    // 마지막 참조라면 여기서 (잠금 밖) 분석기와 그 엔진 인덱스 참조가 해제
 }
 
-std::string UnrealEngineAnalyzer::detectUnrealContext(const std::string& text, int line, int character) {
-    // 간단한 구현 - 실제로는 더 정교한 컨텍스트 감지 필요
-    return "";
+std::shared_ptr<UnrealEngineAnalyzer> LSPServer::analyzerFor(const std::string& uri) const {
+    std::string path = uriToPath(uri);
+    
+    std::lock_guard<std::mutex> lock(workspacesMutex_);
+    
+    // 가장 긴 루트가 우선 (프로젝트 안의 플러그인 프로젝트 등)
+    std::shared_ptr<UnrealEngineAnalyzer> best;
+    size_t bestLength = 0;
+    for (const auto& [root, analyzer] : workspaces_) {
+        if (root.size() > bestLength && path.compare(0, root.size(), root) == 0 &&
+            (path.size() == root.size() || path[root.size()] == '/')) {
+            best = analyzer;
+            bestLength = root.size();
+        }
+    }
+    if (best) return best;
+    
+    auto primary = workspaces_.find(primaryWorkspace_);
+    return primary != workspaces_.end() ? primary->second : nullptr;
 }
 
-UnrealClass* UnrealEngineAnalyzer::findClassAtPosition(const std::string& uri, int line) {
-    // 간단한 구현 - 실제로는 AST 파싱 필요
-    return nullptr;
+std::vector<std::shared_ptr<UnrealEngineAnalyzer>> LSPServer::allAnalyzers() const {
+    std::lock_guard<std::mutex> lock(workspacesMutex_);
+    
+    std::vector<std::shared_ptr<UnrealEngineAnalyzer>> analyzers;
+    analyzers.reserve(workspaces_.size());
+    for (const auto& [root, analyzer] : workspaces_) {
+        analyzers.push_back(analyzer);
+    }
+    return analyzers;
 }
 
-bool UnrealEngineAnalyzer::isHeaderFile(const std::string& uri) {
-    return endsWith(uri, ".h") || endsWith(uri, ".hpp");
+void LSPServer::enablePeriodicStats(std::chrono::seconds interval) {
+    statsDumpWorker_ = std::make_unique<PeriodicWorker>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(interval),
+        []() { std::cerr << ServerMetrics::instance().summaryLine() << std::endl; });
 }
-
-bool UnrealEngineAnalyzer::isSourceFile(const std::string& uri) {
-    return endsWith(uri, ".cpp") || endsWith(uri, ".cc");
+
+void LSPServer::runMaintenance() {
+    constexpr int64_t IdleCompactMs = 30 * 1000;
+    
+    size_t documentBytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(documentsMutex_);
+        for (const auto& [uri, document] : openFiles_) {
+            documentBytes += uri.capacity() + document.text.capacity() + document.lineOffsets.capacity() * sizeof(size_t);
+        }
+    }
+    
+    auto analyzers = allAnalyzers();
+    size_t accounted = documentBytes + EngineIndexRegistry::instance().memoryBytes() +
+                       PluginShardRegistry::instance().memoryBytes() + ParsedHeaderCache::instance().memoryBytes() +
+                       StringInterner::instance().bytesReserved();
+    for (const auto& analyzer : analyzers) {
+        accounted += analyzer->memoryBytes();
+    }
+    
+    // 인터너, 인덱스, 문서는 비울 수 없음 - 캐시는 예산에서 그것들을 뺀 여유 안으로만 줄임
+    // (매 주기 비우면 캐시가 한 주기도 살아남지 못하고, 데몬에서는 다른 세션의 캐시까지 비움)
+    size_t evictable = ParsedHeaderCache::instance().memoryBytes();
+    for (const auto& analyzer : analyzers) {
+        evictable += analyzer->cacheBytes();
+    }
+    const size_t limit = memoryBudget_.limitBytes.load(std::memory_order_relaxed);
+    const size_t fixed = accounted - std::min(evictable, accounted);
+    const size_t headroom = limit > fixed ? limit - fixed : 0;
+    const size_t capacity = std::min(memoryBudget_.cacheBytes(), headroom / (2 * analyzers.size() + 1));
+    for (const auto& analyzer : analyzers) {
+        analyzer->limitCaches(capacity);
+    }
+    // 다른 엔진 버전을 스캔하는 동안에는 버전 간 중복 제거 캐시를 유지
+    if (!EngineIndexRegistry::instance().scanning()) {
+        ParsedHeaderCache::instance().setCapacity(capacity);
+    }
+    
+    const bool wasOverBudget = overBudget_;
+    overBudget_ = accounted > limit;
+    if (overBudget_) {
+        // 예산을 넘은 순간 한 번만 인덱스 압축
+        if (!wasOverBudget) {
+            for (const auto& analyzer : analyzers) {
+                analyzer->compactIndexes();
+            }
+            compactedSinceActivity_ = true;
+            std::cerr << "Memory budget exceeded (" << (accounted >> 20) << " MB > "
+                      << (limit >> 20) << " MB), caches limited to " << (capacity >> 20) << " MB each" << std::endl;
+        }
+    } else {
+        if (wasOverBudget) {
+            std::cerr << "Memory back under budget (" << (accounted >> 20) << " MB <= " << (limit >> 20) << " MB)" << std::endl;
+        }
+        if (!compactedSinceActivity_ && steadyNowMs() - lastActivity_ >= IdleCompactMs) {
+            for (const auto& analyzer : analyzers) {
+                analyzer->compactIndexes();
+            }
+            compactedSinceActivity_ = true;
+        }
+    }
 }
 
-std::string UnrealEngineAnalyzer::getCorrespondingFile(const std::string& uri) {
-    if (isHeaderFile(uri)) {
-        std::string base = uri.substr(0, uri.find_last_of('.'));
-        return base + ".cpp";
-    } else if (isSourceFile(uri)) {
-        std::string base = uri.substr(0, uri.find_last_of('.'));
-        return base + ".h";
+json LSPServer::serverStats() {
+    size_t documentBytes = 0;
+    size_t documentCount = 0;
+    {
+        std::lock_guard<std::mutex> lock(documentsMutex_);
+        documentCount = openFiles_.size();
+        for (const auto& [uri, document] : openFiles_) {
+            documentBytes += uri.capacity() + document.text.capacity() + document.lineOffsets.capacity() * sizeof(size_t);
+        }
     }
     
-    return "";
+    const auto& interner = StringInterner::instance();
+    const auto& engineIndexes = EngineIndexRegistry::instance();
+    const auto& pluginShards = PluginShardRegistry::instance();
+    auto& parsedHeaders = ParsedHeaderCache::instance();
+    size_t analyzerBytes = engineIndexes.memoryBytes() + pluginShards.memoryBytes() + parsedHeaders.memoryBytes();
+    json workspaces = json::object();
+    for (const auto& analyzer : allAnalyzers()) {
+        analyzerBytes += analyzer->memoryBytes();
+        workspaces[analyzer->projectPath()] = analyzer->memoryStats();
+    }
+    
+    json stats = ServerMetrics::instance().snapshot();
+    stats["memory"] = {
+            {"budgetBytes", memoryBudget_.limitBytes.load(std::memory_order_relaxed)},
+            {"accountedBytes", documentBytes + analyzerBytes + interner.bytesReserved()},
+            {"peakResidentBytes", peakResidentBytes()},
+            {"openDocuments", {{"count", documentCount}, {"bytes", documentBytes}}},
+            {"interner", {{"strings", interner.size()}, {"bytes", interner.bytesReserved()}}},
+            {"engineIndexes", engineIndexes.stats()},
+            {"pluginShards", pluginShards.stats()},
+            {"parsedHeaderCache", parsedHeaders.stats()},
+            {"workspaces", workspaces}
+    };
+    return stats;
 }
 
-// =============================================================================
-// LSPServer 구현
-// =============================================================================
+void LSPServer::setMessageWriter(MessageWriter writer) {
+    std::lock_guard<std::mutex> lock(outputMutex_);
+    messageWriter_ = std::move(writer);
+}
 
-void LSPServer::initialize(const std::string& projectPath, const std::string& enginePath) {
-    analyzer_ = std::make_unique<UnrealEngineAnalyzer>(enginePath, projectPath);
+void LSPServer::waitForIndexing() {
+    for (const auto& analyzer : allAnalyzers()) {
+        analyzer->waitForIndexing();
+    }
 }
 
-void LSPServer::run() {
+void LSPServer::run(std::istream& input) {
+    auto& metrics = ServerMetrics::instance();
+    
     std::string line;
-    while (std::getline(std::cin, line)) {
+    while (!exitRequested_ && std::getline(input, line)) {
         if (line.find("Content-Length:") == 0) {
             int contentLength = std::stoi(line.substr(16));
-            std::getline(std::cin, line); // 빈 줄 건너뛰기
+            std::getline(input, line); // 빈 줄 건너뛰기
             
             std::string message;
-            message.resize(contentLength);
-            std::cin.read(&message[0], contentLength);
+            {
+                UNREAL_TRACE_SPAN("read", "io");
+                message.resize(contentLength);
+                input.read(&message[0], contentLength);
+            }
+            
+            metrics.addCounter(MetricCounter::MessagesRead, 1);
+            metrics.addCounter(MetricCounter::BytesRead, static_cast<uint64_t>(contentLength));
             
             handleMessage(message);
         }
@@ -1261,19 +7117,50 @@ void LSPServer::run() {
 }
 
 void LSPServer::handleMessage(const std::string& message) {
+    UNREAL_TRACE_SPAN("dispatch", "lsp");
+    
     try {
+        lastActivity_ = steadyNowMs();
+        compactedSinceActivity_ = false;
+        
         auto parsedMsg = parseMessage(message);
+        ServerMetrics::ScopedLatency latency(ServerMetrics::instance().slot(parsedMsg.method));
+        UNREAL_TRACE_SPAN_DETAIL("handler", "lsp", parsedMsg.method);
         
-        if (parsedMsg.method == "initialize") {
+        if (parsedMsg.method == "shutdown") {
+            sendResponse(parsedMsg.id.value(), nullptr);
+        } else if (parsedMsg.method == "exit") {
+            exitRequested_ = true;
+        } else if (parsedMsg.method == "initialize") {
             handleInitialize(parsedMsg);
         } else if (parsedMsg.method == "textDocument/didOpen") {
             handleTextDocumentDidOpen(parsedMsg);
         } else if (parsedMsg.method == "textDocument/didChange") {
             handleTextDocumentDidChange(parsedMsg);
+        } else if (parsedMsg.method == "textDocument/didClose") {
+            handleTextDocumentDidClose(parsedMsg);
         } else if (parsedMsg.method == "textDocument/completion") {
             handleTextDocumentCompletion(parsedMsg);
+        } else if (parsedMsg.method == "workspace/symbol") {
+            handleWorkspaceSymbol(parsedMsg);
         } else if (parsedMsg.method == "workspace/executeCommand") {
             handleWorkspaceExecuteCommand(parsedMsg);
+        } else if (parsedMsg.method == "workspace/didChangeWorkspaceFolders") {
+            handleDidChangeWorkspaceFolders(parsedMsg);
+        } else if (parsedMsg.method == "initialized") {
+            handleInitialized(parsedMsg);
+        } else if (parsedMsg.method == "textDocument/didSave") {
+            handleTextDocumentDidSave(parsedMsg);
+        } else if (parsedMsg.method == "workspace/didChangeWatchedFiles") {
+            handleDidChangeWatchedFiles(parsedMsg);
+        } else if (parsedMsg.method == "textDocument/prepareRename") {
+            handleTextDocumentPrepareRename(parsedMsg);
+        } else if (parsedMsg.method == "textDocument/rename") {
+            handleTextDocumentRename(parsedMsg);
+        } else if (parsedMsg.method == "textDocument/codeAction") {
+            handleTextDocumentCodeAction(parsedMsg);
+        } else if (parsedMsg.method == "codeAction/resolve") {
+            handleCodeActionResolve(parsedMsg);
         }
     } catch (const std::exception& e) {
         std::cerr << "Error handling message: " << e.what() << std::endl;
@@ -1281,19 +7168,69 @@ void LSPServer::handleMessage(const std::string& message) {
 }
 
 void LSPServer::handleInitialize(const LSPMessage& msg) {
+    const auto options = msg.params.value("initializationOptions", json::object());
+    watchedFilesRegistration_ = msg.params.value("/capabilities/workspace/didChangeWatchedFiles/dynamicRegistration"_json_pointer, false);
+    changeAnnotationSupport_ = msg.params.value("/capabilities/workspace/workspaceEdit/documentChanges"_json_pointer, false) &&
+                               msg.params.contains("/capabilities/workspace/workspaceEdit/changeAnnotationSupport"_json_pointer);
+    const auto resolvable = msg.params.value("/capabilities/textDocument/codeAction/resolveSupport/properties"_json_pointer, json::array());
+    codeActionResolveSupport_ = std::find(resolvable.begin(), resolvable.end(), "edit") != resolvable.end();
+    const json budget = options.is_object() ? options.value("memoryBudgetMB", json()) : json();
+    if (budget.is_number() && budget.get<double>() >= 1) {
+        setMemoryBudget(budget.get<size_t>());
+    } else if (!budget.is_null()) {
+        std::cerr << "⚠️ Ignoring initializationOptions.memoryBudgetMB (expected a positive number): " << budget.dump() << std::endl;
+    }
+    
+    // 멀티 루트: .uproject가 있는 폴더마다 프로젝트 분석기 추가 (엔진 인덱스는 공유)
+    const auto folders = msg.params.value("workspaceFolders", json::array());
+    if (folders.is_array()) {
+        for (const auto& folder : folders) {
+            std::string path = uriToPath(folder.value("uri", ""));
+            if (isUnrealProjectRoot(path)) {
+                addWorkspace(path);
+            }
+        }
+    }
+    
     json result = {
         {"capabilities", {
-            {"textDocumentSync", 1},
+            {"textDocumentSync", {
+                {"openClose", true},
+                {"change", 2},      // Incremental
+                {"save", {{"includeText", false}}}
+            }},
             {"completionProvider", {
                 {"triggerCharacters", {".", "::", "U", "A", "F"}}
             }},
+            {"workspaceSymbolProvider", true},
+            {"renameProvider", {{"prepareProvider", true}}},
+            {"codeActionProvider", {
+                {"codeActionKinds", {"quickfix"}},
+                {"resolveProvider", true}
+            }},
+            {"workspace", {
+                {"workspaceFolders", {
+                    {"supported", true},
+                    {"changeNotifications", true}
+                }}
+            }},
             {"executeCommandProvider", {
                 {"commands", {
                     "unreal.generateUClass",
                     "unreal.generateBlueprintFunction",
                     "unreal.syncHeaderSource",
                     "unreal.analyzeLogs",
-                    "unreal.interpretErrors"
+                    "unreal.interpretErrors",
+                    "unreal.replicationReport",
+                    "unreal.transitiveIncludes",
+                    "unreal.includeDependents",
+                    "unreal.heaviestIncludes",
+                    "unreal.unusedIncludes",
+                    "unreal.headerCostReport",
+                    "unreal.unityBuildPlan",
+                    "unreal.pchCandidates",
+                    "unreal.serverStats",
+                    "unreal.flushTrace"
                 }}
             }}
         }}
@@ -1302,20 +7239,301 @@ void LSPServer::handleInitialize(const LSPMessage& msg) {
     sendResponse(msg.id.value(), result);
 }
 
+void LSPServer::handleDidChangeWorkspaceFolders(const LSPMessage& msg) {
+    const auto& event = msg.params["event"];
+    
+    for (const auto& folder : event.value("removed", json::array())) {
+        removeWorkspace(uriToPath(folder.value("uri", "")));
+    }
+    for (const auto& folder : event.value("added", json::array())) {
+        std::string path = uriToPath(folder.value("uri", ""));
+        if (isUnrealProjectRoot(path)) {
+            addWorkspace(path);
+        }
+    }
+}
+
+void LSPServer::handleInitialized(const LSPMessage&) {
+    if (!watchedFilesRegistration_) return;
+    
+    // 프로젝트 헤더와 UHT 출력(.generated.h)이 에디터 밖에서 바뀌어도 인덱스 갱신
+    sendRequest("client/registerCapability", {
+        {"registrations", {{
+            {"id", "unreal.watchHeaders"},
+            {"method", "workspace/didChangeWatchedFiles"},
+            {"registerOptions", {
+                {"watchers", {
+                    {{"globPattern", "**/Source/**/*.h"}},
+                    {{"globPattern", "**/Intermediate/Build/**/Inc/**/*.generated.h"}}
+                }}
+            }}
+        }}}
+    });
+}
+
+void LSPServer::handleTextDocumentDidSave(const LSPMessage& msg) {
+    std::string uri = msg.params["textDocument"]["uri"];
+    if (auto analyzer = analyzerFor(uri)) {
+        analyzer->refreshHeader(uriToPath(uri));
+    }
+}
+
+void LSPServer::handleTextDocumentPrepareRename(const LSPMessage& msg) {
+    constexpr int RequestFailed = -32803;
+    std::string uri = msg.params["textDocument"]["uri"];
+    std::optional<std::string> text;
+    {
+        std::lock_guard<std::mutex> lock(documentsMutex_);
+        auto it = openFiles_.find(uri);
+        if (it != openFiles_.end()) text = it->second.text;
+    }
+    auto analyzer = analyzerFor(uri);
+    if (!text || !analyzer) {
+        sendResponse(msg.id.value(), nullptr);
+        return;
+    }
+    
+    auto result = analyzer->prepareRename(uriToPath(uri), *text, msg.params["position"]["line"], msg.params["position"]["character"]);
+    if (result.contains("error")) {
+        sendError(msg.id.value(), RequestFailed, result["error"]);
+    } else {
+        sendResponse(msg.id.value(), result);
+    }
+}
+
+void LSPServer::handleTextDocumentRename(const LSPMessage& msg) {
+    constexpr int RequestFailed = -32803;
+    std::string uri = msg.params["textDocument"]["uri"];
+    
+    // 열린 문서는 저장되지 않은 내용으로 편집을 계산
+    std::optional<std::string> text;
+    std::unordered_map<std::string, std::string> openDocuments;
+    std::unordered_map<std::string, int> versions;
+    {
+        std::lock_guard<std::mutex> lock(documentsMutex_);
+        for (const auto& [openUri, document] : openFiles_) {
+            openDocuments[uriToPath(openUri)] = document.text;
+            versions[pathToUri(uriToPath(openUri))] = document.version;
+            if (openUri == uri) text = document.text;
+        }
+    }
+    auto analyzer = analyzerFor(uri);
+    if (!text || !analyzer) {
+        sendResponse(msg.id.value(), nullptr);
+        return;
+    }
+    
+    auto result = analyzer->rename(uriToPath(uri), *text, msg.params["position"]["line"], msg.params["position"]["character"],
+                                   msg.params.value("newName", ""), openDocuments);
+    if (result.contains("error")) {
+        sendError(msg.id.value(), RequestFailed, result["error"]);
+        return;
+    }
+    std::cerr << "✏️ Rename: " << result["edits"] << " edits in " << result["files"] << " files ("
+              << result["unqualifiedEdits"] << " unqualified, " << result["seconds"].get<double>() << "s)" << std::endl;
+    
+    // CoreRedirects 항목과 한정자 없는 멤버 사용은 확인을 거치는 편집으로
+    // (지원하지 않는 클라이언트에는 CoreRedirects 는 메시지로만 안내하고 한정자 없는 사용은 빼고 보냄)
+    const json redirect = result.value("coreRedirect", json());
+    if (!changeAnnotationSupport_) {
+        json changes = json::object();
+        for (auto& [fileUri, edits] : result["changes"].items()) {
+            json confirmed = json::array();
+            for (auto& edit : edits) {
+                if (!edit.contains("annotationId")) confirmed.push_back(std::move(edit));
+            }
+            if (!confirmed.empty()) changes[fileUri] = std::move(confirmed);
+        }
+        if (!redirect.is_null()) {
+            sendNotification("window/showMessage", {
+                {"type", 3},
+                {"message", "Add to [CoreRedirects] in " + redirect["file"].get<std::string>() +
+                            " so existing Blueprints keep working: " + redirect["entry"].get<std::string>()}
+            });
+        }
+        sendResponse(msg.id.value(), {{"changes", changes}});
+        return;
+    }
+    
+    json documentChanges = json::array();
+    for (auto& [fileUri, edits] : result["changes"].items()) {
+        auto version = versions.find(fileUri);
+        documentChanges.push_back({
+            {"textDocument", {{"uri", fileUri}, {"version", version != versions.end() ? json(version->second) : json(nullptr)}}},
+            {"edits", edits}
+        });
+    }
+    json annotations = json::object();
+    if (result["unqualifiedEdits"].get<size_t>() > 0) {
+        annotations["unqualifiedUses"] = {
+            {"label", "Rename unqualified uses"},
+            {"description", "Uses without ->, . or Owner:: outside the declaring class's files; they may be unrelated names"},
+            {"needsConfirmation", true}
+        };
+    }
+    if (!redirect.is_null() && redirect.contains("edit")) {
+        json annotated = redirect["edit"];
+        annotated["annotationId"] = "coreRedirects";
+        documentChanges.push_back({
+            {"textDocument", {{"uri", pathToUri(redirect["file"].get<std::string>())}, {"version", nullptr}}},
+            {"edits", json::array({annotated})}
+        });
+        annotations["coreRedirects"] = {
+            {"label", "Add CoreRedirects entry"},
+            {"description", redirect["entry"]},
+            {"needsConfirmation", true}
+        };
+    }
+    json edit = {{"documentChanges", documentChanges}};
+    if (!annotations.empty()) edit["changeAnnotations"] = annotations;
+    sendResponse(msg.id.value(), edit);
+}
+
+void LSPServer::handleTextDocumentCodeAction(const LSPMessage& msg) {
+    std::string uri = msg.params["textDocument"]["uri"];
+    const auto only = msg.params.value("/context/only"_json_pointer, json());
+    auto analyzer = analyzerFor(uri);
+    if (!analyzer || (only.is_array() && std::find(only.begin(), only.end(), "quickfix") == only.end())) {
+        sendResponse(msg.id.value(), json::array());
+        return;
+    }
+    
+    auto actions = analyzer->codeActions(uriToPath(uri), msg.params.value("/context/diagnostics"_json_pointer, json::array()));
+    
+    // resolve 를 모르는 클라이언트에는 편집까지 계산해서 보냄 (내용을 못 읽으면 보내지 않음)
+    if (!codeActionResolveSupport_ && !actions.empty()) {
+        auto text = documentText(uri);
+        json resolved = json::array();
+        if (text) {
+            for (auto& action : actions) {
+                action = analyzer->resolveCodeAction(std::move(action), uriToPath(uri), *text);
+                if (action.contains("edit")) resolved.push_back(std::move(action));
+            }
+        }
+        actions = std::move(resolved);
+    }
+    sendResponse(msg.id.value(), actions);
+}
+
+std::optional<std::string> LSPServer::documentText(const std::string& uri) {
+    {
+        std::lock_guard<std::mutex> lock(documentsMutex_);
+        auto it = openFiles_.find(uri);
+        if (it != openFiles_.end()) return it->second.text;
+    }
+    // 닫힌 파일이면 디스크 내용으로
+    std::ifstream file(uriToPath(uri));
+    if (!file.is_open()) return std::nullopt;
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+void LSPServer::handleCodeActionResolve(const LSPMessage& msg) {
+    const std::string uri = msg.params.value("/data/uri"_json_pointer, std::string());
+    auto analyzer = analyzerFor(uri);
+    
+    auto text = documentText(uri);
+    if (!analyzer || !text) {
+        sendResponse(msg.id.value(), msg.params);
+        return;
+    }
+    
+    auto action = analyzer->resolveCodeAction(msg.params, uriToPath(uri), *text);
+    if (action.contains("edit")) {
+        std::cerr << "🩹 Quick fix: " << action.value("title", "") << std::endl;
+    }
+    sendResponse(msg.id.value(), action);
+}
+
+void LSPServer::handleDidChangeWatchedFiles(const LSPMessage& msg) {
+    for (const auto& change : msg.params.value("changes", json::array())) {
+        std::string uri = change.value("uri", "");
+        if (auto analyzer = analyzerFor(uri)) {
+            analyzer->refreshHeader(uriToPath(uri));
+        }
+    }
+}
+
 void LSPServer::handleTextDocumentDidOpen(const LSPMessage& msg) {
     std::string uri = msg.params["textDocument"]["uri"];
     std::string text = msg.params["textDocument"]["text"];
     
-    openFiles_[uri] = text;
+    // 콜드 인덱스라도 이 문서가 쓰는 헤더부터 스캔되도록
+    if (auto analyzer = analyzerFor(uri)) {
+        analyzer->focusDocument(uriToPath(uri), text);
+    }
+    
+    {
+        std::lock_guard<std::mutex> lock(documentsMutex_);
+        auto& document = openFiles_[uri];
+        document.setText(std::move(text));
+        document.version = msg.params["textDocument"].value("version", 0);
+    }
+    
+    // 파일을 연 직후에는 디바운스 없이 바로 진단
+    publishDiagnostics(uri);
 }
 
 void LSPServer::handleTextDocumentDidChange(const LSPMessage& msg) {
     std::string uri = msg.params["textDocument"]["uri"];
-    auto changes = msg.params["contentChanges"];
+    const auto& changes = msg.params["contentChanges"];
+    
+    {
+        std::lock_guard<std::mutex> lock(documentsMutex_);
+        auto it = openFiles_.find(uri);
+        if (it == openFiles_.end()) return;     // 열지 않은 문서의 변경은 무시
+        auto& document = it->second;
+        for (const auto& change : changes) {
+            document.applyChange(change);
+        }
+        document.version = msg.params["textDocument"].value("version", document.version);
+    }
+    
+    if (diagnosticsScheduler_) {
+        diagnosticsScheduler_->schedule(uri);
+    }
+}
+
+void LSPServer::handleTextDocumentDidClose(const LSPMessage& msg) {
+    std::string uri = msg.params["textDocument"]["uri"];
+    
+    {
+        std::lock_guard<std::mutex> lock(documentsMutex_);
+        openFiles_.erase(uri);
+    }
+    
+    if (diagnosticsScheduler_) {
+        diagnosticsScheduler_->cancel(uri);
+    }
+    
+    // 닫힌 문서의 진단은 클라이언트에서 지움
+    sendNotification("textDocument/publishDiagnostics", {
+        {"uri", uri},
+        {"diagnostics", json::array()}
+    });
+}
+
+void LSPServer::publishDiagnostics(const std::string& uri) {
+    std::string text;
+    int version = 0;
+    {
+        std::lock_guard<std::mutex> lock(documentsMutex_);
+        auto it = openFiles_.find(uri);
+        if (it == openFiles_.end()) return;
+        text = it->second.text;
+        version = it->second.version;
+    }
     
-    if (!changes.empty()) {
-        openFiles_[uri] = changes[0]["text"];
+    UNREAL_TRACE_SPAN_DETAIL("diagnostics", "analysis", uri);
+    json diagnostics = json::array();
+    for (const auto& diagnostic : macroDiagnostics_.analyze(uri, text)) {
+        diagnostics.push_back(diagnostic.toJson());
     }
+    
+    sendNotification("textDocument/publishDiagnostics", {
+        {"uri", uri},
+        {"version", version},
+        {"diagnostics", diagnostics}
+    });
 }
 
 void LSPServer::handleTextDocumentCompletion(const LSPMessage& msg) {
@@ -1323,8 +7541,18 @@ void LSPServer::handleTextDocumentCompletion(const LSPMessage& msg) {
     int line = msg.params["position"]["line"];
     int character = msg.params["position"]["character"];
     
-    if (openFiles_.find(uri) != openFiles_.end()) {
-        auto completions = analyzer_->getCompletions(uri, line, character, openFiles_[uri]);
+    std::optional<std::string> text;
+    {
+        std::lock_guard<std::mutex> lock(documentsMutex_);
+        auto it = openFiles_.find(uri);
+        if (it != openFiles_.end()) {
+            text = it->second.text;
+        }
+    }
+    
+    auto analyzer = analyzerFor(uri);
+    if (text && analyzer) {
+        auto completions = analyzer->getCompletions(uri, line, character, *text);
         
         json items = json::array();
         for (const auto& completion : completions) {
@@ -1342,40 +7570,143 @@ void LSPServer::handleTextDocumentCompletion(const LSPMessage& msg) {
     }
 }
 
+void LSPServer::handleWorkspaceSymbol(const LSPMessage& msg) {
+    std::string query = msg.params.value("query", "");
+    
+    // 같은 엔진 인덱스/플러그인 샤드를 공유하는 프로젝트는 한 번만 조회
+    json symbols = json::array();
+    std::unordered_set<const DynamicHeaderScanner*> queried;
+    for (const auto& analyzer : allAnalyzers()) {
+        for (auto& symbol : analyzer->findWorkspaceSymbols(query, &queried)) {
+            symbols.push_back(std::move(symbol));
+        }
+    }
+    sendResponse(msg.id.value(), symbols);
+}
+
 void LSPServer::handleWorkspaceExecuteCommand(const LSPMessage& msg) {
     std::string command = msg.params["command"];
     nlohmann::json arguments = msg.params.value("arguments", nlohmann::json::array());
     
+    if (command == "unreal.serverStats") {
+        sendResponse(msg.id.value(), serverStats());
+        return;
+    }
+    if (command == "unreal.flushTrace") {
+        sendResponse(msg.id.value(), TraceRecorder::instance().flush());
+        return;
+    }
+    
+    // 인자의 문서가 속한 프로젝트로 보냄 (없으면 기본 프로젝트)
+    std::string uri;
+    if (!arguments.empty() && arguments[0].is_object() && arguments[0].contains("textDocument")) {
+        uri = arguments[0]["textDocument"].value("uri", "");
+    }
+    auto analyzer = analyzerFor(uri);
+    if (!analyzer) {
+        sendResponse(msg.id.value(), nullptr);
+        return;
+    }
+    
+    if (command == "unreal.transitiveIncludes" || command == "unreal.includeDependents" ||
+        command == "unreal.heaviestIncludes") {
+        json options = !arguments.empty() && arguments[0].is_object() ? arguments[0] : json::object();
+        size_t limit = options.value("limit", command == "unreal.heaviestIncludes" ? 20 : 500);
+        std::string file = options.value("file", uri.empty() ? std::string() : uriToPath(uri));
+        
+        if (command == "unreal.heaviestIncludes") {
+            sendResponse(msg.id.value(), analyzer->heaviestIncludes(options.value("scope", "project") == "project", limit));
+        } else if (command == "unreal.transitiveIncludes") {
+            sendResponse(msg.id.value(), analyzer->transitiveIncludes(file, limit));
+        } else {
+            sendResponse(msg.id.value(), analyzer->includeDependents(file, limit));
+        }
+        return;
+    }
+    if (command == "unreal.headerCostReport") {
+        size_t limit = !arguments.empty() && arguments[0].is_object() ? arguments[0].value("limit", 25) : 25;
+        sendResponse(msg.id.value(), analyzer->headerCostReport(limit));
+        return;
+    }
+    if (command == "unreal.unityBuildPlan") {
+        // 기본 한도는 UBT 의 NumIncludedBytesPerUnityCPP 와 같은 384KB
+        size_t maxUnityBytes = !arguments.empty() && arguments[0].is_object()
+            ? arguments[0].value("maxUnityBytes", size_t{384 * 1024}) : size_t{384 * 1024};
+        sendResponse(msg.id.value(), analyzer->unityBuildPlan(maxUnityBytes));
+        return;
+    }
+    if (command == "unreal.pchCandidates") {
+        json options = !arguments.empty() && arguments[0].is_object() ? arguments[0] : json::object();
+        sendResponse(msg.id.value(), analyzer->pchCandidates(options.value("minFraction", 0.5), options.value("limit", 20)));
+        return;
+    }
+    if (command == "unreal.unusedIncludes") {
+        // textDocument 가 있으면 그 파일만, 없으면 프로젝트 전체
+        sendResponse(msg.id.value(), analyzer->unusedIncludes(uri.empty() ? std::string() : uriToPath(uri)));
+        return;
+    }
+    if (command == "unreal.replicationReport") {
+        bool includeEngine = !arguments.empty() && arguments[0].is_object() && arguments[0].value("includeEngine", false);
+        sendResponse(msg.id.value(), analyzer->replicationReport(includeEngine));
+        return;
+    }
+    
     std::string result;
     
     if (command == "unreal.generateUClass") {
-        result = analyzer_->executeCodeAction("generateUClass", arguments[0]);
+        result = analyzer->executeCodeAction("generateUClass", arguments[0]);
     }
     else if (command == "unreal.generateBlueprintFunction") {
-        result = analyzer_->executeCodeAction("generateBlueprintFunction", arguments[0]);
+        result = analyzer->executeCodeAction("generateBlueprintFunction", arguments[0]);
     }
     else if (command == "unreal.syncHeaderSource") {
-        result = analyzer_->executeCodeAction("syncHeaderSource", arguments[0]);
+        result = analyzer->executeCodeAction("syncHeaderSource", arguments[0]);
     }
     else if (command == "unreal.analyzeLogs") {
-        result = analyzer_->executeCodeAction("analyzeLogs", arguments[0]);
+        result = analyzer->executeCodeAction("analyzeLogs", arguments[0]);
     }
     else if (command == "unreal.interpretErrors") {
-        result = analyzer_->executeCodeAction("interpretErrors", arguments[0]);
+        result = analyzer->executeCodeAction("interpretErrors", arguments[0]);
     }
     
     sendResponse(msg.id.value(), nlohmann::json(result));
 }
 
+void LSPServer::sendError(int id, int code, const std::string& message) {
+    json response;
+    response["jsonrpc"] = "2.0";
+    response["id"] = id;
+    response["error"] = {{"code", code}, {"message", message}};
+    writeMessage(response.dump());
+}
+
 void LSPServer::sendResponse(int id, const json& result) {
     json response;
     response["jsonrpc"] = "2.0";
     response["id"] = id;
     response["result"] = result;
     
-    std::string responseStr = response.dump();
-    std::cout << "Content-Length: " << responseStr.length() << "\r\n\r\n" << responseStr;
-    std::cout.flush();
+    std::string payload;
+    {
+        UNREAL_TRACE_SPAN("serialize", "io");
+        payload = response.dump();
+    }
+    writeMessage(payload);
+}
+
+void LSPServer::sendRequest(const std::string& method, const json& params) {
+    json request;
+    request["jsonrpc"] = "2.0";
+    request["id"] = nextRequestId_++;
+    request["method"] = method;
+    request["params"] = params;
+    
+    std::string payload;
+    {
+        UNREAL_TRACE_SPAN("serialize", "io");
+        payload = request.dump();
+    }
+    writeMessage(payload);
 }
 
 void LSPServer::sendNotification(const std::string& method, const json& params) {
@@ -1384,12 +7715,28 @@ void LSPServer::sendNotification(const std::string& method, const json& params)
     notification["method"] = method;
     notification["params"] = params;
     
-    std::string notificationStr = notification.dump();
-    std::cout << "Content-Length: " << notificationStr.length() << "\r\n\r\n" << notificationStr;
+    std::string payload;
+    {
+        UNREAL_TRACE_SPAN("serialize", "io");
+        payload = notification.dump();
+    }
+    writeMessage(payload);
+}
+
+void LSPServer::writeMessage(const std::string& payload) {
+    // 진단 스레드와 메시지 처리 스레드가 동시에 쓰므로 프레임 단위로 직렬화
+    UNREAL_TRACE_SPAN("write", "io");
+    std::lock_guard<std::mutex> lock(outputMutex_);
+    if (messageWriter_) {
+        messageWriter_("Content-Length: " + std::to_string(payload.length()) + "\r\n\r\n" + payload);
+        return;
+    }
+    std::cout << "Content-Length: " << payload.length() << "\r\n\r\n" << payload;
     std::cout.flush();
 }
 
 LSPMessage LSPServer::parseMessage(const std::string& message) {
+    UNREAL_TRACE_SPAN("parse", "lsp");
     LSPMessage msg;
     
     try {
@@ -1399,7 +7746,7 @@ LSPMessage LSPServer::parseMessage(const std::string& message) {
             msg.id = jsonMsg["id"];
         }
         
-        msg.method = jsonMsg["method"];
+        msg.method = jsonMsg.value("method", "");      // 클라이언트 응답에는 method가 없음
         msg.params = jsonMsg.value("params", json::object());
         
     } catch (const json::exception& e) {
@@ -1419,6 +7766,311 @@ std::string LSPServer::getContext(const std::string& text, int line, int charact
     return "";
 }
 
+// =============================================================================
+// 데몬 모드 구현
+// =============================================================================
+
+namespace {
+
+// 소켓 fd를 std::istream으로 감싸 LSPServer::run에 그대로 넘김
+class FdInputBuffer : public std::streambuf {
+public:
+    explicit FdInputBuffer(int fd) : fd_(fd) {}
+    
+protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+        
+        ssize_t count;
+        do {
+            count = ::read(fd_, buffer_, sizeof(buffer_));
+        } while (count < 0 && errno == EINTR);
+        if (count <= 0) return traits_type::eof();
+        
+        setg(buffer_, buffer_, buffer_ + count);
+        return traits_type::to_int_type(*gptr());
+    }
+    
+private:
+    int fd_;
+    char buffer_[64 * 1024];
+};
+
+bool writeAll(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool socketAddress(const std::string& path, sockaddr_un& address) {
+    address = sockaddr_un{};
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) return false;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+int connectSocket(const std::string& path) {
+    sockaddr_un address;
+    if (!socketAddress(path, address)) return -1;
+    
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+} // namespace
+
+std::string DaemonOptions::defaultSocketPath() {
+    const char* tmp = getenv("TMPDIR");
+    std::string dir = tmp && *tmp ? tmp : "/tmp";
+    while (dir.size() > 1 && dir.back() == '/') dir.pop_back();
+    return dir + "/unreal-lsp-" + std::to_string(::getuid()) + ".sock";
+}
+
+std::string DaemonHandshake::serialize() const {
+    return json{{"projectPath", projectPath}, {"enginePath", enginePath}}.dump();
+}
+
+DaemonHandshake DaemonHandshake::parse(const std::string& line) {
+    json header = json::parse(line);
+    return DaemonHandshake{header.value("projectPath", ""), header.value("enginePath", "")};
+}
+
+LSPDaemon::LSPDaemon(DaemonOptions options) : options_(std::move(options)) {
+    if (options_.socketPath.empty()) {
+        options_.socketPath = DaemonOptions::defaultSocketPath();
+    }
+}
+
+LSPDaemon::~LSPDaemon() {
+    stop();
+    reapSessions(true);
+    if (listenFd_ >= 0) {
+        ::close(listenFd_);
+        ::unlink(options_.socketPath.c_str());
+    }
+    if (lockFd_ >= 0) {
+        ::close(lockFd_);
+    }
+}
+
+int LSPDaemon::serve() {
+    std::signal(SIGPIPE, SIG_IGN);     // 끊긴 세션에 쓰다가 프로세스가 죽지 않도록
+    
+    sockaddr_un address;
+    if (!socketAddress(options_.socketPath, address)) {
+        std::cerr << "❌ Socket path too long: " << options_.socketPath << std::endl;
+        return 1;
+    }
+    
+    // 데몬 수명 동안 잠금 파일을 쥐고 있음 - 프런트엔드 둘이 동시에 데몬을 띄워도 하나만 남음
+    lockFd_ = ::open((options_.socketPath + ".lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    if (lockFd_ < 0 || ::flock(lockFd_, LOCK_EX | LOCK_NB) != 0) {
+        std::cerr << "❌ A daemon is already running on " << options_.socketPath << std::endl;
+        return 1;
+    }
+    ::unlink(options_.socketPath.c_str());     // 비정상 종료로 남은 소켓 파일 정리
+    
+    listenFd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd_ < 0 ||
+        ::bind(listenFd_, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::chmod(options_.socketPath.c_str(), 0600) != 0 ||
+        ::listen(listenFd_, 16) != 0) {
+        std::cerr << "❌ Cannot listen on " << options_.socketPath << ": " << std::strerror(errno) << std::endl;
+        return 1;
+    }
+    ::fcntl(listenFd_, F_SETFD, FD_CLOEXEC);
+    
+    std::cerr << "🛰️  Daemon listening on " << options_.socketPath << std::endl;
+    
+    // 마지막 창이 닫혀도 인덱스를 유지 - 유휴 종료 전에 다시 열면 엔진을 다시 스캔하지 않음
+    const std::chrono::seconds retention = options_.idleTimeout.count() > 0 ? options_.idleTimeout
+                                                                            : DaemonOptions::DefaultRetention;
+    ProjectAnalyzerRegistry::instance().setRetention(retention);
+    EngineIndexRegistry::instance().setRetention(retention);
+    
+    auto idleSince = std::chrono::steady_clock::now();
+    while (!stopRequested_) {
+        pollfd listener{listenFd_, POLLIN, 0};
+        int ready = ::poll(&listener, 1, 500);
+        reapSessions(false);
+        ProjectAnalyzerRegistry::instance().releaseIdle();      // 분석기가 놓은 엔진 인덱스는 다음 번에 만료 대기 시작
+        EngineIndexRegistry::instance().releaseIdle();
+        
+        if (ready > 0 && (listener.revents & POLLIN)) {
+            int clientFd = ::accept(listenFd_, nullptr, nullptr);
+            if (clientFd >= 0) {
+                ::fcntl(clientFd, F_SETFD, FD_CLOEXEC);
+                ++activeSessions_;
+                
+                Session& session = sessions_.emplace_back();
+                session.fd = clientFd;
+                session.thread = std::thread([this, &session]() { runSession(session.fd, session); });
+            }
+        }
+        
+        auto now = std::chrono::steady_clock::now();
+        if (activeSessions_ > 0) {
+            idleSince = now;
+        } else if (options_.idleTimeout.count() > 0 && now - idleSince >= options_.idleTimeout) {
+            std::cerr << "💤 No sessions for " << options_.idleTimeout.count() << "s, daemon exiting" << std::endl;
+            break;
+        }
+    }
+    
+    reapSessions(true);
+    ::close(listenFd_);
+    ::unlink(options_.socketPath.c_str());
+    listenFd_ = -1;
+    
+    // 유지하던 인덱스를 정적 소멸 전에 해제 (백그라운드 스캔 스레드 정리)
+    ProjectAnalyzerRegistry::instance().setRetention(std::chrono::seconds(0));
+    EngineIndexRegistry::instance().setRetention(std::chrono::seconds(0));
+    ProjectAnalyzerRegistry::instance().releaseIdle();
+    EngineIndexRegistry::instance().releaseIdle();
+    return 0;
+}
+
+void LSPDaemon::runSession(int clientFd, Session& session) {
+    try {
+        FdInputBuffer buffer(clientFd);
+        std::istream input(&buffer);
+        
+        std::string header;
+        if (std::getline(input, header)) {
+            auto handshake = DaemonHandshake::parse(header);
+            std::cerr << "🔌 Session connected: " << handshake.projectPath << std::endl;
+            
+            // 세션마다 문서/진단 상태는 따로, 인덱스는 ProjectAnalyzerRegistry / EngineIndexRegistry에서 공유
+            LSPServer server;
+            server.setMessageWriter([clientFd](const std::string& framed) {
+                writeAll(clientFd, framed.data(), framed.size());
+            });
+            server.setMemoryBudget(options_.memoryBudgetMB);
+            server.initialize(handshake.projectPath, handshake.enginePath);
+            server.run(input);
+            
+            std::cerr << "🔌 Session closed: " << handshake.projectPath << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Daemon session error: " << e.what() << std::endl;
+    }
+    
+    --activeSessions_;
+    session.finished = true;
+}
+
+void LSPDaemon::reapSessions(bool all) {
+    for (auto it = sessions_.begin(); it != sessions_.end(); ) {
+        if (!all && !it->finished) {
+            ++it;
+            continue;
+        }
+        if (!it->finished) {
+            ::shutdown(it->fd, SHUT_RDWR);     // 읽기에서 블록된 세션을 깨움
+        }
+        if (it->thread.joinable()) {
+            it->thread.join();
+        }
+        ::close(it->fd);
+        it = sessions_.erase(it);
+    }
+}
+
+DaemonClient::DaemonClient(std::string socketPath, std::string serverExecutable)
+    : socketPath_(socketPath.empty() ? DaemonOptions::defaultSocketPath() : std::move(socketPath)),
+      serverExecutable_(std::move(serverExecutable)) {}
+
+bool DaemonClient::spawnDaemon() {
+    pid_t child = ::fork();
+    if (child < 0) return false;
+    
+    if (child == 0) {
+        // 이중 fork로 편집기 프로세스 그룹과 분리 (좀비도 남기지 않음)
+        ::setsid();
+        if (::fork() != 0) ::_exit(0);
+        
+        int devNull = ::open("/dev/null", O_RDWR);
+        int log = ::open((socketPath_ + ".log").c_str(), O_WRONLY | O_CREAT | O_APPEND, 0600);
+        ::dup2(devNull, STDIN_FILENO);
+        ::dup2(devNull, STDOUT_FILENO);
+        ::dup2(log >= 0 ? log : devNull, STDERR_FILENO);
+        
+        ::execlp(serverExecutable_.c_str(), serverExecutable_.c_str(),
+                 "--daemon", "--socket", socketPath_.c_str(), "--idle-timeout", "600",
+                 static_cast<char*>(nullptr));
+        ::_exit(127);
+    }
+    
+    int status = 0;
+    ::waitpid(child, &status, 0);
+    return true;
+}
+
+int DaemonClient::connectOrSpawn() {
+    int fd = connectSocket(socketPath_);
+    if (fd >= 0 || serverExecutable_.empty()) return fd;
+    
+    std::cerr << "🛰️  Starting shared index daemon on " << socketPath_ << std::endl;
+    if (!spawnDaemon()) return -1;
+    
+    for (int attempt = 0; attempt < 200 && fd < 0; ++attempt) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        fd = connectSocket(socketPath_);
+    }
+    return fd;
+}
+
+int DaemonClient::run(const DaemonHandshake& handshake, int inputFd, int outputFd) {
+    std::signal(SIGPIPE, SIG_IGN);
+    
+    int fd = connectOrSpawn();
+    if (fd < 0) {
+        std::cerr << "❌ Cannot reach daemon at " << socketPath_ << std::endl;
+        return 1;
+    }
+    
+    std::string header = handshake.serialize() + "\n";
+    if (!writeAll(fd, header.data(), header.size())) {
+        ::close(fd);
+        return 1;
+    }
+    
+    // 편집기 -> 데몬. stdin 읽기에서 블록될 수 있으므로 기다리지 않음
+    std::thread([fd, inputFd]() {
+        char buffer[64 * 1024];
+        while (true) {
+            ssize_t count = ::read(inputFd, buffer, sizeof(buffer));
+            if (count < 0 && errno == EINTR) continue;
+            if (count <= 0 || !writeAll(fd, buffer, static_cast<size_t>(count))) break;
+        }
+        ::shutdown(fd, SHUT_WR);
+    }).detach();
+    
+    // 데몬 -> 편집기. 데몬이 세션을 닫으면(exit) 종료
+    char buffer[64 * 1024];
+    while (true) {
+        ssize_t count = ::read(fd, buffer, sizeof(buffer));
+        if (count < 0 && errno == EINTR) continue;
+        if (count <= 0 || !writeAll(outputFd, buffer, static_cast<size_t>(count))) break;
+    }
+    
+    ::close(fd);
+    return 0;
+}
+
 // =============================================================================
 // 나머지 클래스들의 기본 구현
 // =============================================================================
@@ -11,10 +11,21 @@
 #include <algorithm>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <condition_variable>
+#include <functional>
 #include <thread>
 #include <chrono>
 #include <sstream>
 #include <optional>
+#include <list>
+#include <deque>
+#include <map>
+#include <future>
 #include <cstdlib>
 #include "json.hpp"
 
@@ -23,6 +34,8 @@ namespace fs = std::filesystem;
 
 namespace UnrealEngine {
 
+namespace Benchmark { struct KernelAccess; }    // 마이크로 벤치마크가 내부 커널을 직접 호출
+
 // =============================================================================
 // 엔진 버전 관리
 // =============================================================================
@@ -56,18 +69,42 @@ struct EngineVersion {
     }
 };
 
+// 플랫폼별 엔진 설치 후보 경로 (환경변수 UE_ROOT 등은 탐지기가 공통으로 처리)
+class EngineInstallLocator {
+public:
+    virtual ~EngineInstallLocator() = default;
+    
+    virtual std::vector<std::string> candidateRoots() const = 0;
+    
+    // 빌드 대상 플랫폼의 기본 구현
+    static std::unique_ptr<EngineInstallLocator> platformDefault();
+};
+
+// Epic Games Launcher / 직접 설치 위치 (macOS)
+class MacEngineInstallLocator : public EngineInstallLocator {
+public:
+    std::vector<std::string> candidateRoots() const override;
+};
+
+// 소스 빌드 위치 (Linux 등 - 런처가 없는 플랫폼)
+class SourceBuildEngineInstallLocator : public EngineInstallLocator {
+public:
+    std::vector<std::string> candidateRoots() const override;
+};
+
 class UnrealEngineDetector {
 private:
     std::vector<std::string> commonInstallPaths_;
     
 public:
     UnrealEngineDetector();
+    explicit UnrealEngineDetector(const EngineInstallLocator& locator);
     
     std::vector<EngineVersion> findAllEngineVersions();
     EngineVersion detectProjectEngineVersion(const std::string& projectPath);
+    EngineVersion detectEngineVersion(const std::string& enginePath);   // Build.version, 없으면 경로 이름
     
 private:
-    EngineVersion detectEngineVersion(const std::string& enginePath);
     EngineVersion parseEngineAssociation(const std::string& engineAssoc);
 };
 
@@ -82,41 +119,98 @@ private:
 public:
     VersionSpecificAPI();
     
-    std::vector<std::string> getClassMethods(const std::string& className, const EngineVersion& version);
-    std::string getMacroTemplate(const std::string& macroName, const EngineVersion& version);
-    std::vector<std::string> getIncludePaths(const EngineVersion& version);
+    std::vector<std::string> getClassMethods(const std::string& className, const EngineVersion& version) const;
+    std::string getMacroTemplate(const std::string& macroName, const EngineVersion& version) const;
+    std::vector<std::string> getIncludePaths(const EngineVersion& version) const;
     
 private:
     void initializeAPIDatabase();
-    std::string getVersionKey(const EngineVersion& version);
-    std::vector<std::string> getDefaultClassMethods(const std::string& className);
-    std::string getDefaultMacroTemplate(const std::string& macroName, const EngineVersion& version);
-    std::vector<std::string> getDefaultIncludePaths(const EngineVersion& version);
+    const json* findEntry(const EngineVersion& version, const char* section, const std::string& name) const;
+    std::string getVersionKey(const EngineVersion& version) const;
+    std::vector<std::string> getDefaultClassMethods(const std::string& className) const;
+    std::string getDefaultMacroTemplate(const std::string& macroName, const EngineVersion& version) const;
+    std::vector<std::string> getDefaultIncludePaths(const EngineVersion& version) const;
 };
 
 // =============================================================================
-// 동적 헤더 스캐너
+// 문자열 인터닝 (심볼 이름 공유 저장소)
 // =============================================================================
 
-class DynamicHeaderScanner {
+using SymbolId = uint32_t;
+
+// 블록 단위 bump 할당 - 개별 해제 없이 프로세스 수명 동안 유지
+class StringArena {
+public:
+    explicit StringArena(size_t blockSize = 64 * 1024);
+    
+    std::string_view store(std::string_view value);
+    size_t bytesUsed() const { return bytesUsed_; }
+    size_t bytesReserved() const { return bytesReserved_; }
+    
 private:
-    EngineVersion engineVersion_;
-    std::string enginePath_;
-    std::unordered_map<std::string, std::vector<std::string>> scannedClasses_;
+    std::vector<std::unique_ptr<char[]>> blocks_;
+    size_t blockSize_;
+    char* cursor_ = nullptr;
+    size_t remaining_ = 0;
+    size_t bytesUsed_ = 0;
+    size_t bytesReserved_ = 0;
+};
+
+// 프로세스 전역 인터너 - 같은 문자열은 하나의 32비트 id와 하나의 저장소를 공유
+// id -> 문자열 조회는 잠금 없이 수행 (페이지는 한 번 할당되면 이동하지 않음)
+class StringInterner {
+public:
+    static constexpr SymbolId EmptyId = 0;
     
+    static StringInterner& instance();
+    
+    SymbolId intern(std::string_view value);
+    std::optional<SymbolId> find(std::string_view value) const;
+    std::string_view view(SymbolId id) const;
+    
+    size_t size() const { return count_.load(std::memory_order_acquire); }
+    size_t bytesReserved() const;
+    
+private:
+    StringInterner();
+    
+    static constexpr size_t PageBits = 12;
+    static constexpr size_t PageSize = size_t(1) << PageBits;
+    static constexpr size_t MaxPages = 4096;
+    
+    mutable std::shared_mutex mutex_;
+    StringArena arena_;
+    std::unordered_map<std::string_view, SymbolId> ids_;
+    std::array<std::atomic<std::string_view*>, MaxPages> pages_{};
+    std::atomic<size_t> count_{0};
+};
+
+class InternedString {
 public:
-    DynamicHeaderScanner(const EngineVersion& version);
+    InternedString() = default;
+    InternedString(std::string_view value) : id_(StringInterner::instance().intern(value)) {}
+    InternedString(const std::string& value) : InternedString(std::string_view(value)) {}
+    InternedString(const char* value) : InternedString(std::string_view(value)) {}
+    
+    static InternedString fromId(SymbolId id) { InternedString s; s.id_ = id; return s; }
+    
+    SymbolId id() const { return id_; }
+    bool empty() const { return id_ == StringInterner::EmptyId; }
+    std::string_view view() const { return StringInterner::instance().view(id_); }
+    std::string str() const { return std::string(view()); }
+    operator std::string_view() const { return view(); }
     
-    void scanEngineHeaders();
-    std::vector<std::string> getClassMethods(const std::string& className);
+    bool operator==(const InternedString& other) const { return id_ == other.id_; }
+    bool operator!=(const InternedString& other) const { return id_ != other.id_; }
     
 private:
-    std::vector<std::string> getEnginePaths();
-    void scanDirectory(const std::string& dirPath);
-    void scanHeaderFile(const std::string& filePath);
-    std::vector<std::string> extractClassMethods(const std::string& content, const std::string& className);
+    SymbolId id_ = StringInterner::EmptyId;
 };
 
+inline std::ostream& operator<<(std::ostream& os, const InternedString& value) {
+    return os << value.view();
+}
+
 // =============================================================================
 // LSP 관련 구조체
 // =============================================================================
@@ -136,7 +230,7 @@ struct CompletionItem {
 };
 
 struct Location {
-    std::string uri;
+    InternedString uri;
     struct Range {
         struct Position {
             int line;
@@ -146,24 +240,769 @@ struct Location {
 };
 
 struct FunctionInfo {
-    std::string name;
+    InternedString name;
     std::string signature;
     Location location;
-    std::vector<std::string> parameters;
-    std::string returnType;
+    std::vector<InternedString> parameters;
+    InternedString returnType;
     
     std::string generateBlueprintWrapper() const;
 };
 
 struct UnrealClass {
-    std::string name;
-    std::string baseClass;
-    std::vector<std::string> includes;
+    InternedString name;
+    InternedString baseClass;
+    std::vector<InternedString> includes;
     std::vector<FunctionInfo> functions;
-    std::vector<std::string> properties;
+    std::vector<InternedString> properties;
     Location location;
 };
 
+// =============================================================================
+// 컬럼형 심볼 테이블
+// =============================================================================
+
+enum class SymbolKind : uint8_t {
+    Class,
+    Struct,
+    Function,
+    Property,
+    Enum,
+    Typedef         // GENERATED_BODY 가 만드는 Super / ThisClass
+};
+
+namespace SymbolFlags {
+    constexpr uint32_t None        = 0;
+    constexpr uint32_t Virtual     = 1u << 0;
+    constexpr uint32_t Static      = 1u << 1;
+    constexpr uint32_t Const       = 1u << 2;
+    constexpr uint32_t Override    = 1u << 3;
+    constexpr uint32_t Generated   = 1u << 4;   // 헤더에 없고 UHT 가 만드는 멤버 (합성)
+}
+
+// UPROPERTY 지정자 - Property 행의 flags 컬럼 상위 비트 (SymbolFlags 와 겹치지 않음)
+namespace PropertyFlags {
+    constexpr uint32_t Replicated          = 1u << 8;      // ReplicatedUsing 도 포함
+    constexpr uint32_t RepNotify           = 1u << 9;      // ReplicatedUsing=OnRep_...
+    constexpr uint32_t NotReplicated       = 1u << 10;
+    constexpr uint32_t Transient           = 1u << 11;
+    constexpr uint32_t SaveGame            = 1u << 12;
+    constexpr uint32_t Config              = 1u << 13;
+    constexpr uint32_t EditAnywhere        = 1u << 14;
+    constexpr uint32_t EditDefaultsOnly    = 1u << 15;
+    constexpr uint32_t EditInstanceOnly    = 1u << 16;
+    constexpr uint32_t VisibleAnywhere     = 1u << 17;
+    constexpr uint32_t BlueprintReadWrite  = 1u << 18;
+    constexpr uint32_t BlueprintReadOnly   = 1u << 19;
+    constexpr uint32_t BlueprintAssignable = 1u << 20;
+    constexpr uint32_t Instanced           = 1u << 21;
+    constexpr uint32_t DuplicateTransient  = 1u << 22;
+    constexpr uint32_t Interp              = 1u << 23;
+    
+    uint32_t fromSpecifier(std::string_view specifier);     // 모르는 지정자는 0
+    json toJson(uint32_t flags);                            // 켜진 지정자 이름 목록
+}
+
+struct SymbolRecord {
+    SymbolId name = StringInterner::EmptyId;
+    SymbolKind kind = SymbolKind::Function;
+    SymbolId owner = StringInterner::EmptyId;      // 소속 클래스 이름 id (최상위 심볼은 0)
+    SymbolId file = StringInterner::EmptyId;       // 파일 경로 id
+    int32_t startLine = 0;
+    int32_t endLine = 0;
+    uint32_t flags = SymbolFlags::None;
+    SymbolId type = StringInterner::EmptyId;       // 프로퍼티 타입 ("TArray<FVector>", 그 외 0)
+};
+
+// 행 단위 구조체 대신 컬럼별 연속 배열로 저장 - 전체 인덱스를 훑는 필터가
+// 필요한 컬럼만 순차적으로 읽도록 (자동 벡터화 가능한 단순 루프)
+class SymbolTable {
+public:
+    using RowId = uint32_t;
+    
+    RowId add(const SymbolRecord& record);
+    void append(const std::vector<SymbolRecord>& records);
+    void removeFile(SymbolId file);
+    void clear();
+    
+    size_t size() const { return names_.size(); }
+    SymbolRecord row(RowId row) const;
+    
+    // owner/kind가 일치하는 행 - 정수 컬럼 두 개만 스트리밍
+    std::vector<RowId> rowsOwnedBy(SymbolId owner, SymbolKind kind) const;
+    // kind 가 일치하고 flags 에 mask 비트가 하나라도 켜진 행 - kind/flags 컬럼만 스트리밍
+    std::vector<RowId> rowsWithFlags(SymbolKind kind, uint32_t mask) const;
+    std::vector<RowId> rowsOfKind(SymbolKind kind) const;
+    std::vector<RowId> rowsNamed(SymbolId name) const;
+    // 대소문자 무시 subsequence 매칭, 점수 순 정렬
+    std::vector<RowId> fuzzyMatch(std::string_view query, size_t limit) const;
+    // fuzzyMatch 의 점수 (subsequence 가 아니면 nullopt) - 여러 테이블의 결과를 합칠 때
+    static std::optional<int> fuzzyScore(std::string_view name, SymbolKind kind, std::string_view query);
+    
+    size_t memoryBytes() const;
+    void compact();     // 삭제/재스캔으로 남은 여유 용량 반환
+    
+    static uint32_t characterMask(std::string_view text);
+    
+private:
+    std::vector<SymbolId> names_;
+    std::vector<uint8_t> kinds_;
+    std::vector<SymbolId> owners_;
+    std::vector<SymbolId> files_;
+    std::vector<int32_t> startLines_;
+    std::vector<int32_t> endLines_;
+    std::vector<uint32_t> flags_;
+    std::vector<SymbolId> types_;
+    std::vector<uint32_t> nameMasks_;   // 이름에 등장하는 문자 집합 비트마스크 (fuzzy 사전 필터)
+    std::unordered_map<SymbolId, uint32_t> fileRows_;     // 파일 -> 행 수 (행이 없는 파일은 removeFile 생략)
+};
+
+// =============================================================================
+// 서버 계측 (지연 시간 히스토그램 / 카운터)
+// =============================================================================
+
+enum class MetricCounter : size_t {
+    MessagesRead,
+    BytesRead,
+    FilesScanned,
+    BytesScanned,
+    ScanMicros,
+    ClassesMaterialized,    // 지연 모드에서 처음 요청 시 파싱한 클래스 수
+    HeadersDeduplicated,    // 내용이 같은 헤더를 다시 파싱하지 않고 재사용한 수
+    Count
+};
+
+// 스레드마다 자기 블록에만 relaxed 원자 연산으로 기록하고, 조회 시 모든 블록을 합산
+// (핫 패스에 잠금이나 캐시 라인 경합 없음)
+class ServerMetrics {
+public:
+    static constexpr size_t MaxSlots = 64;
+    static constexpr size_t BucketCount = 160;      // log-linear: 2의 거듭제곱당 4개
+    
+    static ServerMetrics& instance();
+    
+    // 이름별 히스토그램 슬롯 (LSP 메서드, 큐 등) - 스레드별 캐시에 없을 때만 잠금
+    size_t slot(std::string_view name);
+    void recordLatency(size_t slot, uint64_t micros, uint64_t allocations = 0);
+    void addCounter(MetricCounter counter, uint64_t value);
+    
+    json snapshot() const;
+    std::string summaryLine() const;
+    
+    // 현재 스레드에서 지금까지 수행된 operator new 호출 수 - 교체 operator new
+    // (AllocationCounting.cpp, 서버/벤치마크 실행 파일에만 링크) 가 없으면 항상 0
+    static uint64_t threadAllocations();
+    static void countAllocation() { ++allocationCount_; }
+    
+    class ScopedLatency {
+    public:
+        explicit ScopedLatency(size_t slot);
+        ~ScopedLatency();
+    private:
+        size_t slot_;
+        std::chrono::steady_clock::time_point start_;
+        uint64_t allocationsAtStart_;
+    };
+    
+private:
+    struct Histogram {
+        std::array<std::atomic<uint64_t>, BucketCount> buckets{};
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> sumMicros{0};
+        std::atomic<uint64_t> maxMicros{0};
+        std::atomic<uint64_t> allocations{0};
+    };
+    
+    struct ThreadBlock {
+        std::array<Histogram, MaxSlots> histograms;
+        std::array<std::atomic<uint64_t>, static_cast<size_t>(MetricCounter::Count)> counters{};
+    };
+    
+    ServerMetrics() = default;
+    ThreadBlock& localBlock();
+    void releaseBlock(ThreadBlock* block);      // 스레드 종료 시 - retired_ 에 합산하고 재사용 목록으로
+    size_t registerSlot(std::string_view name);
+    static size_t bucketFor(uint64_t micros);
+    static uint64_t bucketUpperBound(size_t bucket);
+    
+    mutable std::mutex registryMutex_;
+    std::vector<std::unique_ptr<ThreadBlock>> blocks_;     // 지금까지 만든 블록 (재사용 대기 중인 것은 0)
+    std::vector<ThreadBlock*> freeBlocks_;                  // 종료한 스레드가 돌려준 블록
+    ThreadBlock retired_;                                   // 종료한 스레드들의 누적값
+    std::map<std::string, size_t, std::less<>> slots_;
+    std::vector<std::string> slotNames_;
+    static thread_local uint64_t allocationCount_;
+};
+
+// =============================================================================
+// Chrome Trace Event 기록 (--trace-file)
+// =============================================================================
+
+// 스레드별 고정 크기 링 버퍼에 스팬을 기록하고 종료 시 또는 명령으로 JSON 출력
+// 비활성 상태에서는 스팬마다 전역 플래그 하나만 확인
+class TraceRecorder {
+public:
+    static constexpr size_t RingCapacity = 1 << 16;    // 스레드당 이벤트 수
+    
+    static TraceRecorder& instance();
+    static bool enabled() { return enabled_.load(std::memory_order_relaxed); }
+    
+    void start(const std::string& outputPath);
+    bool flush();
+    
+    // name/category는 정적 문자열 리터럴이어야 함 (포인터만 저장)
+    void record(const char* name, const char* category, SymbolId detail,
+                std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
+    
+    class Span {
+    public:
+        Span(const char* name, const char* category, SymbolId detail = StringInterner::EmptyId) {
+            if (TraceRecorder::enabled()) {
+                name_ = name;
+                category_ = category;
+                detail_ = detail;
+                start_ = std::chrono::steady_clock::now();
+            }
+        }
+        ~Span() {
+            if (name_) {
+                TraceRecorder::instance().record(name_, category_, detail_, start_, std::chrono::steady_clock::now());
+            }
+        }
+        Span(const Span&) = delete;
+        Span& operator=(const Span&) = delete;
+        
+    private:
+        const char* name_ = nullptr;
+        const char* category_ = nullptr;
+        SymbolId detail_ = StringInterner::EmptyId;
+        std::chrono::steady_clock::time_point start_;
+    };
+    
+private:
+    // flush 가 기록 중인 칸을 읽지 않도록 칸마다 시퀀스 (seqlock) - 필드는 relaxed 원자 변수
+    struct Event {
+        std::atomic<uint64_t> sequence{0};      // 2 * index + 1: 쓰는 중, 2 * index + 2: 완료
+        std::atomic<const char*> name{nullptr};
+        std::atomic<const char*> category{nullptr};
+        std::atomic<SymbolId> detail{StringInterner::EmptyId};
+        std::atomic<uint64_t> startMicros{0};
+        std::atomic<uint64_t> durationMicros{0};
+    };
+    
+    struct ThreadBuffer {
+        uint32_t threadId;
+        std::atomic<uint64_t> head{0};      // 지금까지 기록된 이벤트 수 (단일 생산자)
+        std::unique_ptr<Event[]> events;
+    };
+    
+    TraceRecorder() = default;
+    ThreadBuffer& localBuffer();
+    void releaseBuffer(ThreadBuffer* buffer);   // 스레드 종료 시 - 기록은 그대로 두고 재사용 목록으로
+    
+    static std::atomic<bool> enabled_;
+    std::string outputPath_;
+    std::chrono::steady_clock::time_point origin_;
+    std::mutex registryMutex_;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;     // flush 는 재사용 대기 중인 것도 읽음
+    std::vector<ThreadBuffer*> freeBuffers_;                 // 종료한 스레드가 돌려준 버퍼
+};
+
+#define UNREAL_TRACE_CONCAT_INNER(a, b) a##b
+#define UNREAL_TRACE_CONCAT(a, b) UNREAL_TRACE_CONCAT_INNER(a, b)
+#define UNREAL_TRACE_SPAN(...) \
+    ::UnrealEngine::TraceRecorder::Span UNREAL_TRACE_CONCAT(traceSpan_, __LINE__)(__VA_ARGS__)
+// 경로/URI 처럼 인터닝이 필요한 detail 은 기록 중일 때만 평가 (꺼져 있으면 잠금/영구 인터닝 없음)
+#define UNREAL_TRACE_SPAN_DETAIL(name, category, text) \
+    UNREAL_TRACE_SPAN(name, category, ::UnrealEngine::TraceRecorder::enabled() \
+        ? ::UnrealEngine::InternedString(text).id() : ::UnrealEngine::StringInterner::EmptyId)
+
+// =============================================================================
+// 메모리 예산 및 캐시
+// =============================================================================
+
+// 바이트 단위 용량을 가진 LRU 캐시 - 용량을 넘으면 가장 오래 쓰지 않은 항목부터 제거
+template <typename Key, typename Value>
+class LruCache {
+public:
+    explicit LruCache(size_t capacityBytes = 0) : capacityBytes_(capacityBytes) {}
+    
+    std::optional<Value> get(const Key& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            ++misses_;
+            return std::nullopt;
+        }
+        ++hits_;
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return it->second->value;
+    }
+    
+    void put(const Key& key, Value value, size_t bytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            bytes_ -= it->second->bytes;
+            entries_.erase(it->second);
+            index_.erase(it);
+        }
+        if (bytes > capacityBytes_) return;
+        
+        entries_.push_front({key, std::move(value), bytes});
+        index_[key] = entries_.begin();
+        bytes_ += bytes;
+        evictLocked(capacityBytes_);
+    }
+    
+    void setCapacity(size_t capacityBytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacityBytes_ = capacityBytes;
+        evictLocked(capacityBytes_);
+    }
+    
+    void trim(size_t targetBytes) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        evictLocked(targetBytes);
+    }
+    
+    void clear() { trim(0); }
+    
+    json stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return {
+            {"entries", entries_.size()},
+            {"bytes", bytes_},
+            {"capacityBytes", capacityBytes_},
+            {"hits", hits_},
+            {"misses", misses_},
+            {"hitRatio", hits_ + misses_ ? static_cast<double>(hits_) / static_cast<double>(hits_ + misses_) : 0.0},
+            {"evictions", evictions_}
+        };
+    }
+    
+    size_t bytes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return bytes_;
+    }
+    
+private:
+    struct Entry {
+        Key key;
+        Value value;
+        size_t bytes;
+    };
+    
+    void evictLocked(size_t targetBytes) {
+        while (bytes_ > targetBytes && !entries_.empty()) {
+            bytes_ -= entries_.back().bytes;
+            index_.erase(entries_.back().key);
+            entries_.pop_back();
+            ++evictions_;
+        }
+    }
+    
+    mutable std::mutex mutex_;
+    std::list<Entry> entries_;
+    std::unordered_map<Key, typename std::list<Entry>::iterator> index_;
+    size_t capacityBytes_;
+    size_t bytes_ = 0;
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t evictions_ = 0;
+};
+
+// 전역 메모리 예산 - 캐시는 예산의 일부만 사용하고, 예산 초과 시 캐시 비우기와 인덱스 압축
+struct MemoryBudget {
+    static constexpr size_t DefaultBudgetMB = 1024;
+    static constexpr size_t CacheShareDivisor = 8;     // 예산의 1/8을 캐시에 할당
+    
+    // initialize 에서 쓰고 유지보수 스레드가 읽음
+    std::atomic<size_t> limitBytes{DefaultBudgetMB * 1024 * 1024};
+    
+    MemoryBudget() = default;
+    MemoryBudget(const MemoryBudget& other) : limitBytes(other.limitBytes.load(std::memory_order_relaxed)) {}
+    MemoryBudget& operator=(const MemoryBudget& other) {
+        limitBytes.store(other.limitBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+    
+    size_t cacheBytes() const { return limitBytes.load(std::memory_order_relaxed) / CacheShareDivisor; }
+};
+
+// 내용이 같은 헤더는 엔진 버전이 달라도 파싱 결과가 같음 - 내용 해시로 프로세스 전체에서 공유
+// (5.3/5.4/5.5 를 함께 인덱싱하면 바뀌지 않은 헤더는 한 번만 파싱)
+class ParsedHeaderCache {
+public:
+    using Records = std::shared_ptr<const std::vector<SymbolRecord>>;   // file 필드는 비워 둠
+    
+    static ParsedHeaderCache& instance();
+    static uint64_t contentHash(std::string_view content);     // 길이 포함 64비트 해시
+    
+    std::optional<Records> find(uint64_t hash) { return cache_.get(hash); }
+    void store(uint64_t hash, std::vector<SymbolRecord> records);
+    
+    void setCapacity(size_t bytes) { cache_.setCapacity(bytes); }
+    void clear() { cache_.clear(); }
+    json stats() const { return cache_.stats(); }
+    size_t memoryBytes() const { return cache_.bytes(); }
+    
+private:
+    LruCache<uint64_t, Records> cache_{MemoryBudget{}.cacheBytes()};
+};
+
+// 인덱싱 순서: 열린 파일과 그 include (전이) -> 열린 파일의 모듈 -> 나머지
+enum class IndexPriority : uint8_t { Focus = 0, Module = 1, Background = 2 };
+
+// 스캔할 헤더 대기열 - didOpen 이 올 때마다 아직 스캔하지 않은 파일을 앞으로 올림
+class IndexScheduler {
+public:
+    struct Item {
+        std::string path;
+        IndexPriority priority;
+    };
+    
+    void enqueue(const std::vector<std::string>& files);     // Background 로 추가
+    std::optional<Item> next();                             // 우선순위가 가장 높은 파일 하나
+    
+    // includes: "GameFramework/Actor.h" 같은 include 경로 또는 절대 경로.
+    // 목록을 아직 받기 전이면 (최근 MaxDeferredFocus 개만) 기억해 두었다가 enqueue 때 적용, 스캔이 끝났으면 버림
+    void focus(const std::vector<std::string>& includes, const std::string& moduleRoot);
+    void focusIncludesOf(const std::string& filePath);      // Focus 로 스캔한 파일의 include 를 전이적으로
+    void finish();          // 스캔을 건너뜀 (미리 빌드한 인덱스 적재 등) - 기억한 focus 를 버림
+    
+    static constexpr size_t MaxDeferredFocus = 16;
+    
+    static std::vector<std::string> parseIncludes(std::string_view content);
+    static std::string moduleRootOf(const std::string& filePath);   // .../Source/Module (Public/Private/Classes 위)
+    
+    size_t pendingCount() const;
+    json stats() const;
+    void clear();
+    
+private:
+    enum class State { NotStarted, Scanning, Finished };
+    
+    std::vector<SymbolId> resolve(std::string_view include) const;   // mutex_ 잡은 상태
+    void finishLocked();                                             // mutex_ 잡은 상태
+    void promote(SymbolId file, IndexPriority priority);             // mutex_ 잡은 상태
+    void focusFile(SymbolId file);                                   // mutex_ 잡은 상태
+    void applyFocus(const std::vector<std::string>& includes, const std::string& moduleRoot);  // mutex_ 잡은 상태
+    
+    mutable std::mutex mutex_;
+    std::deque<SymbolId> queues_[3];                                // 우선순위별 (승격 전 항목은 건너뜀)
+    std::unordered_map<SymbolId, IndexPriority> pending_;           // 아직 스캔하지 않은 파일 -> 현재 우선순위
+    std::unordered_multimap<std::string, SymbolId> byFileName_;     // "Actor.h" -> 경로 (include 해석용)
+    std::deque<SymbolId> expand_;                                   // 이미 스캔된 Focus 파일 (include 만 펼침)
+    std::unordered_set<SymbolId> expanded_;
+    std::vector<std::pair<std::vector<std::string>, std::string>> deferredFocus_;
+    State state_ = State::NotStarted;       // 대기열이 비면 Finished (다음 enqueue 에서 다시 Scanning)
+    uint64_t promotions_ = 0;
+    uint64_t focusScanned_ = 0;
+};
+
+// =============================================================================
+// 동적 헤더 스캐너
+// =============================================================================
+
+class DynamicHeaderScanner {
+private:
+    EngineVersion engineVersion_;
+    std::string enginePath_;
+    SymbolTable symbols_;
+    mutable std::mutex mutex_;      // 백그라운드 스캔과 자동완성 조회 사이 보호
+    std::atomic<uint64_t> generation_{0};   // 테이블이 바뀔 때마다 증가 (캐시 무효화용)
+    std::atomic<bool> cancelled_{false};
+    
+    // 지연 파싱: 스캔 때는 클래스 선언 위치만 기록하고 멤버는 처음 조회할 때 파싱
+    struct PendingClass {
+        SymbolId file;
+        size_t offset;          // "class XXX_API Name" 의 시작 위치
+        uint64_t fileGeneration;    // 기록할 때의 LazyFile::generation
+    };
+    struct LazyFile {
+        uint64_t generation = 0;    // 다시 스캔할 때마다 바뀜 - 파싱 도중 바뀌었으면 결과를 버림
+        std::vector<SymbolId> classes;
+    };
+    bool lazy_ = false;
+    std::unordered_map<SymbolId, std::vector<PendingClass>> pendingClasses_;   // 클래스 -> 선언들
+    std::unordered_map<SymbolId, LazyFile> lazyFiles_;                         // 파일 -> 클래스 (재스캔 시 정리)
+    std::mutex materializeMutex_;   // 같은 클래스를 두 번 파싱하지 않도록
+    
+    IndexScheduler scheduler_;
+    
+public:
+    DynamicHeaderScanner(const EngineVersion& version);
+    
+    void setLazyParsing(bool lazy) { lazy_ = lazy; }     // 스캔 전에 설정
+    size_t pendingClassCount() const;
+    
+    void scanEngineHeaders(size_t workers = 1);     // workers > 1 이면 파일 단위로 병렬 스캔
+    void scanDirectories(const std::vector<std::string>& directories);     // 절대 경로 (플러그인 등)
+    void scanFiles(const std::vector<std::string>& files, size_t workers = 1);  // 대기열 우선순위 순서로 스캔
+    // 열린 문서의 include 와 모듈을 먼저 스캔하도록 대기열 재정렬
+    void focus(const std::vector<std::string>& includes, const std::string& moduleRoot) {
+        scheduler_.focus(includes, moduleRoot);
+    }
+    json queueStats() const { return scheduler_.stats(); }
+    void skipScan() { scheduler_.finish(); }       // 스캔 없이 행을 채웠을 때 (미리 빌드한 인덱스)
+    std::vector<InternedString> getClassMethods(const std::string& className);
+    std::vector<SymbolRecord> getClassMembers(const std::string& className);    // 메서드 + 생성된 typedef
+    std::vector<SymbolRecord> propertiesWithFlags(uint32_t mask);                // PropertyFlags 중 하나라도
+    std::vector<SymbolRecord> classDeclarations() const;                         // 클래스 행 (선언한 헤더 포함)
+    std::vector<SymbolRecord> symbolsNamed(SymbolId name) const;                 // 이름이 정확히 같은 행
+    std::vector<SymbolRecord> findSymbols(std::string_view query, size_t limit);
+    void rescanFile(const std::string& filePath);   // 바뀐 파일 하나만 다시 스캔 (없어졌으면 제거)
+    
+    // 미리 빌드한 인덱스 저장/적재용 전체 행 복사
+    std::vector<SymbolRecord> records() const;
+    void adoptRecords(const std::vector<SymbolRecord>& records);
+    
+    uint64_t generation() const { return generation_.load(std::memory_order_acquire); }
+    size_t memoryBytes() const;
+    void compact();
+    void cancel() { cancelled_ = true; }
+    
+private:
+    std::vector<std::string> getEnginePaths();
+    void scanDirectory(const std::string& dirPath);
+    void scanHeaderFile(const std::string& filePath);
+    void indexClassDeclarations(SymbolId fileId, const std::string& content);
+    void forgetLazyFile(SymbolId fileId);      // mutex_ 잡은 채로 호출
+    void materializeClasses(const std::vector<SymbolId>& classIds);     // 파일별로 묶어 파싱
+    std::vector<SymbolRecord> extractClassProperties(const std::string& content, const std::string& className,
+                                                     SymbolId fileId, size_t declarationOffset = 0);
+    // GENERATED_BODY / UFUNCTION 지정자로부터 UHT 가 만들 멤버를 합성
+    std::vector<SymbolRecord> synthesizeGeneratedMembers(const std::string& content, const std::string& className,
+                                                         SymbolId fileId, size_t declarationOffset = 0);
+    std::vector<FunctionInfo> extractClassMethods(const std::string& content, const std::string& className,
+                                                  size_t declarationOffset = 0);
+    
+    friend struct Benchmark::KernelAccess;
+};
+
+// =============================================================================
+// 미리 빌드한 엔진 인덱스 (--build-index 로 생성, 서버는 mmap 으로 적재)
+// =============================================================================
+
+// 파일 배치 (모두 호스트 바이트 순서, 4바이트 정렬):
+//   Header | uint32 stringOffsets[stringCount + 1] | char strings[] | pad
+//   | uint32 names[rows] | uint32 owners[rows] | uint32 files[rows] | uint32 types[rows]
+//   | int32 startLines[rows] | int32 endLines[rows] | uint32 flags[rows] | uint8 kinds[rows]
+// 문자열 0번은 빈 문자열. 엔진 안의 파일 경로는 설치 경로 기준 상대 경로로 저장해서
+// 빌드 머신과 설치 위치가 달라도 그대로 사용
+class PrebuiltEngineIndex {
+public:
+    static constexpr uint32_t FormatVersion = 3;     // 2: 생성된 멤버, 3: UPROPERTY 행 + types 컬럼
+    static constexpr char Magic[8] = {'U', 'E', 'L', 'S', 'P', 'I', 'D', 'X'};
+    
+    struct Header {
+        char magic[8];
+        uint32_t formatVersion;
+        int32_t major;
+        int32_t minor;
+        int32_t patch;
+        uint32_t changelist;        // Build.version "Changelist" (없으면 0 - 검사 생략)
+        uint32_t stringCount;
+        uint32_t rowCount;
+        uint32_t stringBytes;
+    };
+    
+    static std::string fileNameFor(const EngineVersion& version);
+    // $UNREAL_LSP_INDEX_DIR, <엔진>/Engine/Intermediate/UnrealLSP, 사용자 캐시 디렉토리 순
+    static std::vector<std::string> searchPaths(const EngineVersion& version);
+    static std::optional<std::string> find(const EngineVersion& version);
+    
+    static bool write(const DynamicHeaderScanner& scanner, const EngineVersion& version, const std::string& path);
+    // 버전/체인지리스트가 맞으면 스캐너에 적재, 아니면 false (호출자가 직접 스캔)
+    static bool load(const std::string& path, const EngineVersion& version, DynamicHeaderScanner& scanner);
+    
+private:
+    static uint32_t readChangelist(const std::string& installPath);
+};
+
+// =============================================================================
+// 플러그인 카탈로그 (.uplugin / .uproject)
+// =============================================================================
+
+struct PluginDescriptor {
+    std::string name;
+    std::string descriptorPath;         // .uplugin
+    std::string rootPath;
+    std::string versionName;
+    bool isProjectPlugin = false;
+    std::vector<std::string> dependencies;      // .uplugin "Plugins" 중 Enabled 항목
+};
+
+class PluginCatalog {
+public:
+    // 하위 폴더에서 .uplugin을 찾음 - 플러그인 폴더를 찾으면 그 안으로는 내려가지 않음
+    static std::vector<PluginDescriptor> discover(const std::string& pluginsRoot, bool isProjectPlugin);
+    static std::optional<PluginDescriptor> readDescriptor(const fs::path& upluginPath, bool isProjectPlugin);
+    
+    // .uproject가 켠 엔진 플러그인 + 끄지 않은 프로젝트 플러그인, 의존성까지 포함
+    static std::vector<PluginDescriptor> resolveEnabled(const std::string& projectPath,
+                                                        const std::vector<PluginDescriptor>& enginePlugins);
+};
+
+// =============================================================================
+// 공유 엔진 인덱스 (같은 EngineVersion을 쓰는 프로젝트들이 참조로 공유)
+// =============================================================================
+
+class EngineIndex {
+public:
+    explicit EngineIndex(const EngineVersion& version, bool lazyParsing = false);  // 생성 즉시 백그라운드 스캔 시작
+    ~EngineIndex();
+    
+    EngineIndex(const EngineIndex&) = delete;
+    EngineIndex& operator=(const EngineIndex&) = delete;
+    
+    const EngineVersion& version() const { return version_; }
+    const VersionSpecificAPI& api() const { return api_; }
+    DynamicHeaderScanner& scanner() { return scanner_; }
+    const DynamicHeaderScanner& scanner() const { return scanner_; }
+    
+    void waitForIndexing();
+    size_t memoryBytes() const { return scanner_.memoryBytes(); }
+    bool loadedPrebuilt() const { return loadedPrebuilt_; }
+    bool scanning() const { return scanning_; }     // 스캔 스레드가 아직 도는 중 (적재 포함)
+    
+    // Engine/Plugins 아래 .uplugin 목록 (처음 요청할 때 한 번만 탐색)
+    const std::vector<PluginDescriptor>& enginePlugins();
+    
+private:
+    EngineVersion version_;
+    VersionSpecificAPI api_;
+    DynamicHeaderScanner scanner_;
+    std::once_flag pluginsDiscovered_;
+    std::vector<PluginDescriptor> enginePlugins_;
+    std::atomic<bool> loadedPrebuilt_{false};
+    std::atomic<bool> scanning_{true};
+    std::mutex scanThreadMutex_;    // 여러 프로젝트가 동시에 waitForIndexing 해도 join은 한 번
+    std::thread scanThread_;
+};
+
+// 레지스트리 항목 - 유지 기간이 있으면 마지막 사용자가 놓은 뒤에도 그 기간 동안 강한 참조를 쥠
+// (데몬에서 창을 모두 닫았다가 다시 열어도 인덱스를 처음부터 만들지 않도록)
+template <typename T>
+struct RetainedRef {
+    std::weak_ptr<T> weak;
+    std::shared_ptr<T> retained;
+    std::optional<std::chrono::steady_clock::time_point> unusedSince;
+    
+    void hold(const std::shared_ptr<T>& value, bool retain) {
+        weak = value;
+        retained = retain ? value : nullptr;
+        unusedSince.reset();
+    }
+    
+    // 레지스트리 밖에서 쓰는 참조 수
+    long users() const {
+        auto value = weak.lock();
+        return value ? value.use_count() - 1 - (retained ? 1 : 0) : 0;
+    }
+    
+    // 유지 기간이 지난 강한 참조를 released 로 옮김 (해제는 레지스트리 잠금 밖에서) - 항목을 지워도 되면 true
+    bool expire(std::chrono::steady_clock::time_point now, std::chrono::steady_clock::duration retention,
+                std::vector<std::shared_ptr<T>>& released) {
+        if (retained) {
+            if (retained.use_count() > 1) {
+                unusedSince.reset();
+            } else {
+                if (!unusedSince) unusedSince = now;
+                if (now - *unusedSince >= retention) {
+                    released.push_back(std::move(retained));
+                    retained.reset();
+                }
+            }
+        }
+        return !retained && weak.expired();
+    }
+};
+
+// 엔진 버전 + 설치 경로별로 인덱스 하나 - 마지막 프로젝트가 놓으면 (유지 기간이 있으면 그 뒤에) 해제
+class EngineIndexRegistry {
+public:
+    static EngineIndexRegistry& instance();
+    
+    std::shared_ptr<EngineIndex> acquire(const EngineVersion& version);
+    json stats() const;
+    size_t memoryBytes() const;
+    
+    // 데몬: 쓰는 프로젝트가 없어진 인덱스를 retention 동안 유지. releaseIdle 이 주기적으로 만료 처리
+    void setRetention(std::chrono::steady_clock::duration retention);
+    void releaseIdle();
+    bool scanning() const;      // 스캔 중인 엔진이 있으면 ParsedHeaderCache 를 줄이지 않음 (버전 간 중복 제거)
+    
+    // 이후 생성되는 엔진 인덱스/플러그인 샤드를 지연 파싱으로 스캔
+    void setLazyParsing(bool lazy) { lazyParsing_ = lazy; }
+    bool lazyParsing() const { return lazyParsing_; }
+    
+private:
+    static std::string keyFor(const EngineVersion& version);
+    
+    std::atomic<bool> lazyParsing_{false};
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, RetainedRef<EngineIndex>> indexes_;
+    std::chrono::steady_clock::duration retention_{0};
+};
+
+// =============================================================================
+// 플러그인 인덱스 샤드 (플러그인별로 따로 빌드하고 버전 + 파일 스탬프로 재사용)
+// =============================================================================
+
+class PluginIndexShard {
+public:
+    PluginIndexShard(PluginDescriptor descriptor, std::string cacheKey);
+    
+    void build();       // Source/** 헤더 스캔
+    
+    const PluginDescriptor& descriptor() const { return descriptor_; }
+    const std::string& cacheKey() const { return cacheKey_; }
+    DynamicHeaderScanner& scanner() { return scanner_; }
+    size_t memoryBytes() const { return scanner_.memoryBytes(); }
+    
+private:
+    PluginDescriptor descriptor_;
+    std::string cacheKey_;
+    DynamicHeaderScanner scanner_;
+};
+
+class PluginShardRegistry {
+public:
+    static PluginShardRegistry& instance();
+    
+    // 키가 같은 샤드가 살아 있으면 재사용, 없거나 헤더가 바뀌었으면 새로 빌드
+    std::shared_ptr<PluginIndexShard> acquire(const PluginDescriptor& descriptor);
+    json stats() const;
+    size_t memoryBytes() const;
+    
+    // "버전|헤더 경로/크기/수정시각 해시" - 파싱 없이 stat만으로 계산
+    static std::string cacheKeyFor(const PluginDescriptor& descriptor);
+    
+private:
+    mutable std::mutex mutex_;
+    std::mutex buildMutex_;     // 같은 플러그인을 두 프로젝트가 동시에 빌드하지 않도록
+    std::unordered_map<std::string, std::weak_ptr<PluginIndexShard>> shards_;   // descriptorPath 기준
+};
+
+// =============================================================================
+// 문서 모델 (증분 동기화)
+// =============================================================================
+
+struct TextDocument {
+    std::string text;
+    int version = 0;
+    std::vector<size_t> lineOffsets;    // 각 줄의 시작 바이트 오프셋
+    
+    void setText(std::string newText);
+    void applyChange(const json& change);   // range가 있으면 증분, 없으면 전체 교체
+    size_t offsetAt(int line, int character) const;
+    
+private:
+    void rebuildLineOffsets(size_t fromLine);
+};
+
 // =============================================================================
 // 로그 분석 시스템
 // =============================================================================
@@ -187,9 +1026,9 @@ struct LogIssue {
     LogType type;
     LogSeverity severity;
     std::string message;
-    std::string file;
+    InternedString file;
     int line;
-    std::string suggestion;
+    InternedString suggestion;
     
     std::string formatForDisplay() const;
 };
@@ -208,6 +1047,8 @@ private:
     void initializePatterns();
     std::vector<std::string> findLogFiles(const std::string& projectPath);
     std::vector<LogIssue> analyzeLogFile(const std::string& logFile);
+    
+    friend struct Benchmark::KernelAccess;
 };
 
 // =============================================================================
@@ -237,6 +1078,7 @@ struct CompileError {
     ErrorCategory category;
     std::string solution;
     double confidence;
+    std::string subject;        // 패턴이 잡은 이름 (없는 식별자, 모듈 등)
     
     std::string formatSolution() const;
 };
@@ -250,11 +1092,74 @@ public:
     
     std::vector<CompileError> analyzeErrors(const std::string& projectPath);
     std::string generateErrorReport(const std::vector<CompileError>& errors);
+    CompileError interpretError(const std::string& errorMessage) const;
     
 private:
     void initializePatterns();
     std::vector<std::string> extractCompileErrors(const std::string& projectPath);
-    CompileError interpretError(const std::string& errorMessage);
+    
+    friend struct Benchmark::KernelAccess;
+};
+
+// =============================================================================
+// 실시간 매크로 진단
+// =============================================================================
+
+struct MacroDiagnostic {
+    int line;
+    int startCharacter;
+    int endCharacter;
+    int severity;           // LSP DiagnosticSeverity (1 = Error, 2 = Warning)
+    std::string code;
+    std::string message;
+    ErrorCategory category;
+    
+    json toJson() const;
+};
+
+// UBT 빌드 없이 열린 문서에서 바로 잡을 수 있는 UHT 매크로 실수 검사
+// (CompileErrorInterpreter의 UnrealMacro 패턴과 동일한 범주)
+class UnrealMacroDiagnostics {
+public:
+    std::vector<MacroDiagnostic> analyze(const std::string& uri, const std::string& text) const;
+};
+
+// 주기적으로 콜백을 실행하는 백그라운드 스레드 (유휴 시 유지보수 등)
+class PeriodicWorker {
+public:
+    PeriodicWorker(std::chrono::milliseconds interval, std::function<void()> callback);
+    ~PeriodicWorker();
+    
+private:
+    std::chrono::milliseconds interval_;
+    std::function<void()> callback_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+    std::thread worker_;
+};
+
+// URI별 디바운스 - 타이핑 중 연속 변경은 마지막 변경 후 한 번만 분석
+class DiagnosticsScheduler {
+public:
+    using Callback = std::function<void(const std::string& uri)>;
+    
+    DiagnosticsScheduler(std::chrono::milliseconds delay, Callback callback);
+    ~DiagnosticsScheduler();
+    
+    void schedule(const std::string& uri);
+    void cancel(const std::string& uri);
+    
+private:
+    void workerLoop();
+    
+    std::chrono::milliseconds delay_;
+    Callback callback_;
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> deadlines_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+    std::thread worker_;
 };
 
 // =============================================================================
@@ -314,6 +1219,127 @@ public:
     std::string generateUProperty(const std::string& propertyName, const std::string& type);
 };
 
+// =============================================================================
+// Include 그래프
+// =============================================================================
+
+// #include 를 파일 노드 사이의 간선으로 해석한 그래프 - 정방향/역방향 CSR (노드 번호는 경로 정렬 순)
+// 줄 앞부분만 보는 include 스캔 결과는 파일 크기 + 수정 시간이 같으면 다음 빌드에 재사용
+class IncludeGraph {
+public:
+    using NodeId = uint32_t;
+    
+    struct Closure {
+        std::vector<NodeId> nodes;      // 시작 노드 제외, BFS 순서
+        uint64_t bytes = 0;             // nodes 파일 크기 합
+        uint64_t lines = 0;             // nodes 줄 수 합
+    };
+    
+    void build(const std::vector<std::string>& files);      // 절대 경로 (헤더 + 소스)
+    
+    std::optional<NodeId> find(const std::string& filePath) const;
+    std::optional<NodeId> resolve(NodeId from, const std::string& include) const;
+    SymbolId file(NodeId node) const { return files_[node]; }
+    std::string_view path(NodeId node) const { return InternedString::fromId(files_[node]).view(); }
+    uint32_t fileBytes(NodeId node) const { return bytes_[node]; }
+    uint32_t fileLines(NodeId node) const { return lines_[node]; }
+    size_t nodeCount() const { return files_.size(); }
+    size_t directIncludeCount(NodeId node) const { return offsets_[node + 1] - offsets_[node]; }
+    std::vector<NodeId> directIncludes(NodeId node) const;
+    std::vector<NodeId> directIncluders(NodeId node) const;
+    
+    Closure transitiveIncludes(NodeId node) const;      // 이 파일이 끌어오는 모든 파일
+    Closure dependents(NodeId node) const;              // 이 파일을 바꾸면 다시 컴파일되는 파일
+    
+    struct ClosureCost {
+        uint64_t bytes = 0;             // 자신 제외 (Closure 와 같음)
+        uint64_t lines = 0;
+        uint32_t includes = 0;
+    };
+    using ReachVisitor = std::function<void(size_t root, NodeId reached)>;
+    // roots 각각의 전이 include 비용 - roots 에서 도달하는 부분 그래프를 SCC 로 축약한 DAG 위에서
+    // 자식 비트셋을 합치는 DP 로 노드마다 한 번만 계산하고, 합산은 workers 개 스레드로.
+    // visit 은 호출한 스레드에서 (root, 도달 노드) 마다 호출
+    std::vector<ClosureCost> closureCosts(const std::vector<NodeId>& roots, size_t workers,
+                                          const ReachVisitor& visit = nullptr) const;
+    static constexpr size_t MaxClosureMatrixBytes = size_t{256} << 20;     // 넘으면 루트마다 BFS
+    
+    json stats() const;
+    size_t memoryBytes() const;
+    
+private:
+    Closure reach(NodeId start, const std::vector<uint32_t>& offsets, const std::vector<uint32_t>& edges) const;
+    
+    struct ParsedFile {
+        fs::file_time_type modified;
+        uintmax_t bytes = 0;
+        uint32_t lines = 0;
+        std::vector<std::string> includes;
+    };
+    
+    std::vector<SymbolId> files_;
+    std::vector<uint32_t> bytes_;
+    std::vector<uint32_t> lines_;
+    std::vector<uint32_t> offsets_, edges_;                 // 정방향: files_[i] 가 include 하는 노드
+    std::vector<uint32_t> reverseOffsets_, reverseEdges_;   // 역방향: files_[i] 를 include 하는 노드
+    std::unordered_map<SymbolId, NodeId> nodes_;
+    std::unordered_multimap<std::string, NodeId> byFileName_;     // "Actor.h" -> 노드 (include 해석용)
+    std::unordered_map<SymbolId, ParsedFile> parsed_;
+    size_t unresolved_ = 0;         // 그래프 밖 (시스템 헤더, .generated.h 등)
+    double buildSeconds_ = 0;
+};
+
+// 파일 하나의 include 목록, 식별자 사용과 선언하는 이름 - 내용만으로 정해지므로 내용 해시로 캐시
+struct IncludeUsage {
+    struct Include {
+        int line;
+        std::string path;
+    };
+    
+    std::vector<Include> includes;
+    // 이름 -> 완전한 타입이 필요한 사용이 있는지 (false 면 포인터/참조/TObjectPtr<> 로만 사용)
+    std::unordered_map<std::string, bool> identifiers;
+    // 이 파일이 선언하는 이름 (정렬, 중복 제거) - #define, 타입, typedef/using, DECLARE_* 타입, 전역 함수
+    std::vector<std::string> declares;
+    
+    static IncludeUsage analyze(std::string_view content);     // 주석/문자열 제외
+    size_t memoryBytes() const;
+};
+
+// =============================================================================
+// 교차 참조 인덱스 (이름 바꾸기)
+// =============================================================================
+
+// 파일별 식별자 집합 - 이름이 나오는 파일만 골라 다시 읽어 정확한 위치를 찾음 (주석/문자열 제외)
+class CrossReferenceIndex {
+public:
+    struct Occurrence {
+        int line;
+        int character;          // UTF-16 코드 유닛
+        SymbolId name;          // names 중 일치한 이름
+        size_t offset;          // content 안의 바이트 오프셋
+    };
+    
+    // 수정 시각 (열린 문서는 내용 해시) 이 바뀐 파일만 다시 읽고, 목록에 없는 파일은 버림
+    void refresh(const std::vector<std::string>& files,
+                 const std::unordered_map<std::string, std::string>& openDocuments, size_t workers);
+    std::vector<std::string> filesMentioning(const std::vector<SymbolId>& names) const;
+    
+    static std::vector<Occurrence> occurrences(std::string_view content, const std::vector<SymbolId>& names);
+    json stats() const;
+    size_t memoryBytes() const;
+    
+private:
+    struct FileEntry {
+        int64_t modified = 0;
+        uint64_t contentHash = 0;               // 열린 문서는 내용 해시로 비교
+        std::vector<SymbolId> identifiers;      // 정렬, 중복 없음
+    };
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, FileEntry> files_;
+    size_t rescans_ = 0;
+};
+
 // =============================================================================
 // 버전 호환 자동완성
 // =============================================================================
@@ -321,15 +1347,38 @@ public:
 class VersionCompatibleAutoComplete {
 private:
     EngineVersion engineVersion_;
-    VersionSpecificAPI apiDatabase_;
-    DynamicHeaderScanner headerScanner_;
+    std::shared_ptr<EngineIndex> engineIndex_;      // 공유 (엔진 심볼, API 테이블)
+    std::vector<std::shared_ptr<PluginIndexShard>> pluginShards_;  // .uproject가 켠 플러그인만
+    mutable std::mutex pluginShardsMutex_;
+    DynamicHeaderScanner projectScanner_;           // 프로젝트 Source 헤더 (저장/UHT 재생성 시 파일 단위 갱신)
+    LruCache<std::string, std::shared_ptr<const std::vector<json>>> completionCache_{MemoryBudget{}.cacheBytes()};   // 프로젝트별
+    std::atomic<uint64_t> completionCacheGeneration_{0};
     
 public:
-    VersionCompatibleAutoComplete(const EngineVersion& version);
+    explicit VersionCompatibleAutoComplete(std::shared_ptr<EngineIndex> engineIndex);
+    
+    void waitForIndexing() { engineIndex_->waitForIndexing(); }
+    const std::shared_ptr<EngineIndex>& engineIndex() const { return engineIndex_; }
+    
+    void addPluginShard(std::shared_ptr<PluginIndexShard> shard);
+    std::vector<std::shared_ptr<PluginIndexShard>> pluginShards() const;
+    DynamicHeaderScanner& projectScanner() { return projectScanner_; }
     
-    std::vector<json> getCompletions(const std::string& prefix, const std::string& context);
+    // 캐시에 있으면 복사 없이 같은 결과를 공유
+    std::shared_ptr<const std::vector<json>> getCompletions(const std::string& prefix, const std::string& context);
+    // queried: 여러 프로젝트가 공유하는 인덱스를 한 번만 조회하기 위한 집합 (선택)
+    std::vector<SymbolRecord> findSymbols(std::string_view query, size_t limit,
+                                          std::unordered_set<const DynamicHeaderScanner*>* queried = nullptr);
+    
+    // 메모리 관리
+    void setCacheBudget(size_t bytes) { completionCache_.setCapacity(bytes); }
+    size_t cacheBytes() const { return completionCache_.bytes(); }
+    void compactIndexes() { engineIndex_->scanner().compact(); projectScanner_.compact(); }
+    json memoryStats() const;
+    size_t memoryBytes() const;
     
 private:
+    std::vector<DynamicHeaderScanner*> scanners();     // 프로젝트, 엔진, 플러그인 순
     std::vector<json> getMacroCompletions(const std::string& prefix);
     std::vector<json> getMemberCompletions(const std::string& context, const std::string& prefix);
 };
@@ -358,8 +1407,33 @@ private:
     std::unordered_map<std::string, UnrealClass> fileClasses_;
     std::mutex dataMutex_;
     
+    // 프로젝트 헤더 + 플러그인 샤드 로딩 (백그라운드)
+    std::thread indexThread_;
+    std::mutex indexThreadMutex_;
+    std::unordered_map<std::string, std::vector<std::string>> projectHeadersByStem_;  // "MyActor" -> .../MyActor.h
+    std::atomic<bool> cancelled_{false};
+    
+    // 프로젝트 + 엔진 + 플러그인 Include 그래프 (질의 시 필요하면 다시 빌드)
+    IncludeGraph includeGraph_;
+    std::mutex includeGraphMutex_;
+    std::atomic<bool> includeGraphStale_{true};
+    LruCache<uint64_t, std::shared_ptr<const IncludeUsage>> includeUsageCache_{MemoryBudget{}.cacheBytes()};
+    CrossReferenceIndex crossReferences_;
+    std::mutex renameMutex_;
+    
+    // 커서 아래의 이름 바꿀 프로젝트 심볼
+    struct RenameTarget {
+        std::string name;                       // Foo_Implementation 위에서 불러도 Foo
+        SymbolRecord declaration;
+        std::vector<std::string> suffixes;      // 함께 바꿀 UHT 파생 이름 ("_Implementation", "_Validate")
+        int line = 0;
+        int character = 0;                      // name 이 시작하는 UTF-16 위치
+        std::string error;
+    };
+    
 public:
     UnrealEngineAnalyzer(const std::string& enginePath, const std::string& projectPath);
+    ~UnrealEngineAnalyzer();
     
     // 코드 생성 기능
     std::string generateUClassTemplate(const std::string& className, const std::string& baseClass);
@@ -373,6 +1447,47 @@ public:
     // LSP 기능
     std::string executeCodeAction(const std::string& action, const nlohmann::json& params);
     std::vector<CompletionItem> getCompletions(const std::string& uri, int line, int character, const std::string& text);
+    json findWorkspaceSymbols(const std::string& query,
+                              std::unordered_set<const DynamicHeaderScanner*>* queried = nullptr);
+    void waitForIndexing();
+    // 저장된 프로젝트 헤더, 또는 UHT 가 다시 만든 .generated.h 의 원본 헤더를 다시 스캔
+    void refreshHeader(const std::string& filePath);
+    // 열린 문서의 include 와 모듈을 프로젝트/엔진 인덱싱 대기열 앞으로
+    void focusDocument(const std::string& filePath, const std::string& text);
+    // 클래스별 복제 프로퍼티 수와 예상 크기 (프로젝트 + 프로젝트 플러그인, 선택적으로 엔진)
+    json replicationReport(bool includeEngine);
+    // Include 그래프 질의 (그래프는 처음 질의할 때 만들고 헤더가 바뀌면 다시 만듦)
+    json transitiveIncludes(const std::string& filePath, size_t limit);
+    json includeDependents(const std::string& filePath, size_t limit);
+    json heaviestIncludes(bool projectOnly, size_t limit);
+    // 쓰지 않는 include 와 전방 선언으로 바꿀 수 있는 include (filePath 가 비면 프로젝트 전체를 병렬로)
+    json unusedIncludes(const std::string& filePath);
+    // 프로젝트 헤더별 전처리 비용 (전이 include 바이트/줄 x 그 헤더를 포함하는 .cpp 수) 순위
+    json headerCostReport(size_t limit);
+    // 모듈별 unity 묶음 제안 - 전이 include 가 많이 겹치는 .cpp 끼리 (MinHash 유사도로 탐욕적 군집)
+    json unityBuildPlan(size_t maxUnityBytes);
+    // 모듈별 PCH 후보 - 번역 단위의 minFraction 이상이 끌어오는 헤더를 한 번만 파싱할 때 줄어드는 바이트 순
+    json pchCandidates(double minFraction, size_t limit);
+    // 프로젝트 클래스 / 함수 / UPROPERTY 이름 바꾸기 - 이름이 나오는 파일만 골라 파일별 편집을 병렬로 계산하고,
+    // 리플렉션되는 심볼이면 블루프린트 에셋용 CoreRedirects 항목을 함께 제안. openDocuments 는 경로 -> 열린 문서 내용
+    json prepareRename(const std::string& filePath, const std::string& text, int line, int character);
+    json rename(const std::string& filePath, const std::string& text, int line, int character,
+                const std::string& newName, const std::unordered_map<std::string, std::string>& openDocuments);
+    // 컴파일 에러 / 매크로 진단의 빠른 수정 - 목록은 진단 메시지만 보고 만들고 (인덱스 조회 없음),
+    // 편집은 사용자가 고른 항목만 resolveCodeAction 에서 계산
+    json codeActions(const std::string& filePath, const json& diagnostics);
+    json resolveCodeAction(json action, const std::string& filePath, const std::string& text);
+    
+    const std::string& projectPath() const { return projectPath_; }
+    const std::shared_ptr<EngineIndex>& engineIndex() const { return autoComplete_->engineIndex(); }
+    
+    // 메모리 관리
+    void applyMemoryBudget(const MemoryBudget& budget);
+    void limitCaches(size_t bytes);     // 캐시마다 bytes 까지 (넘는 항목은 오래된 것부터 제거)
+    size_t cacheBytes() const;          // 비울 수 있는 메모리 (자동완성 + include 사용 캐시)
+    void compactIndexes();
+    json memoryStats() const;
+    size_t memoryBytes() const;
     
     // 유틸리티
     std::vector<CompletionItem> generateUnrealMacroCompletions(const std::string& currentWord, const std::string& context);
@@ -388,6 +1503,32 @@ private:
     bool isHeaderFile(const std::string& uri);
     bool isSourceFile(const std::string& uri);
     std::string getCorrespondingFile(const std::string& uri);
+    IncludeGraph& includeGraph();       // includeGraphMutex_ 잡은 상태
+    RenameTarget renameTarget(const std::string& text, int line, int character);
+    std::optional<SymbolRecord> typeDeclaration(const std::string& name);     // 프로젝트 우선
+};
+
+// 프로젝트 루트 + 엔진 경로별로 분석기 하나 - 같은 프로젝트를 연 세션(데몬 창, 워크스페이스)이 공유하고
+// 마지막 세션이 놓으면 (유지 기간이 있으면 그 뒤에) 해제
+class ProjectAnalyzerRegistry {
+public:
+    static ProjectAnalyzerRegistry& instance();
+    
+    // projectPath 는 정규화된 루트. 분석기 생성 (엔진 감지, 인덱스 적재) 은 잠금 밖에서 하고,
+    // 같은 프로젝트를 동시에 여는 세션은 먼저 시작한 생성을 기다림
+    std::shared_ptr<UnrealEngineAnalyzer> acquire(const std::string& enginePath, const std::string& projectPath);
+    
+    void setRetention(std::chrono::steady_clock::duration retention);
+    void releaseIdle();
+    
+private:
+    struct Slot : RetainedRef<UnrealEngineAnalyzer> {
+        std::shared_future<std::shared_ptr<UnrealEngineAnalyzer>> pending;     // 생성 중
+    };
+    
+    std::mutex mutex_;
+    std::unordered_map<std::string, Slot> analyzers_;
+    std::chrono::steady_clock::duration retention_{0};
 };
 
 // =============================================================================
@@ -395,30 +1536,160 @@ private:
 // =============================================================================
 
 class LSPServer {
+public:
+    // Content-Length 프레임이 붙은 완성된 메시지를 받아 전송 (기본: stdout)
+    using MessageWriter = std::function<void(const std::string& framed)>;
+    
 private:
-    std::unique_ptr<UnrealEngineAnalyzer> analyzer_;
-    std::unordered_map<std::string, std::string> openFiles_;
+    // 워크스페이스 루트(프로젝트 경로)별 분석기 - ProjectAnalyzerRegistry, 엔진 인덱스는 EngineIndexRegistry가 공유
+    std::map<std::string, std::shared_ptr<UnrealEngineAnalyzer>> workspaces_;
+    std::string primaryWorkspace_;
+    std::string enginePath_;
+    mutable std::mutex workspacesMutex_;
+    std::unordered_map<std::string, TextDocument> openFiles_;
+    std::atomic<bool> exitRequested_{false};
+    std::mutex documentsMutex_;
+    std::mutex outputMutex_;
+    std::atomic<int> nextRequestId_{1};
+    bool watchedFilesRegistration_ = false;     // 클라이언트가 didChangeWatchedFiles 동적 등록 지원
+    bool changeAnnotationSupport_ = false;      // WorkspaceEdit 의 확인이 필요한 편집 (documentChanges + changeAnnotations)
+    bool codeActionResolveSupport_ = false;     // codeAction/resolve 로 edit 를 나중에 채울 수 있음
+    MessageWriter messageWriter_;
+    UnrealMacroDiagnostics macroDiagnostics_;
+    MemoryBudget memoryBudget_;
+    std::atomic<int64_t> lastActivity_{0};     // steady_clock 기준 ms
+    std::atomic<bool> compactedSinceActivity_{true};
+    bool overBudget_ = false;       // 유지보수 스레드 전용 - 상태가 바뀔 때만 로그
+    // 백그라운드 스레드는 다른 멤버를 참조하므로 가장 먼저 파괴되도록 마지막에 선언
+    std::unique_ptr<DiagnosticsScheduler> diagnosticsScheduler_;
+    std::unique_ptr<PeriodicWorker> maintenanceWorker_;
+    std::unique_ptr<PeriodicWorker> statsDumpWorker_;
     
 public:
+    void setMemoryBudget(size_t megabytes);
+    void enablePeriodicStats(std::chrono::seconds interval);
     void initialize(const std::string& projectPath, const std::string& enginePath = "");
-    void run();
+    void setMessageWriter(MessageWriter writer);
+    void waitForIndexing();
+    
+    // 멀티 루트 워크스페이스
+    bool addWorkspace(const std::string& projectPath);
+    void removeWorkspace(const std::string& projectPath);
+    void run(std::istream& input = std::cin);
     
     // LSP 메시지 핸들러
     void handleMessage(const std::string& message);
     void handleInitialize(const LSPMessage& msg);
     void handleTextDocumentDidOpen(const LSPMessage& msg);
     void handleTextDocumentDidChange(const LSPMessage& msg);
+    void handleTextDocumentDidClose(const LSPMessage& msg);
     void handleTextDocumentCompletion(const LSPMessage& msg);
+    void handleWorkspaceSymbol(const LSPMessage& msg);
     void handleWorkspaceExecuteCommand(const LSPMessage& msg);
+    void handleDidChangeWorkspaceFolders(const LSPMessage& msg);
+    void handleInitialized(const LSPMessage& msg);
+    void handleTextDocumentDidSave(const LSPMessage& msg);
+    void handleDidChangeWatchedFiles(const LSPMessage& msg);
+    void handleTextDocumentPrepareRename(const LSPMessage& msg);
+    void handleTextDocumentRename(const LSPMessage& msg);
+    void handleTextDocumentCodeAction(const LSPMessage& msg);
+    void handleCodeActionResolve(const LSPMessage& msg);
     
     // 응답 전송
     void sendResponse(int id, const json& result);
+    void sendError(int id, int code, const std::string& message);
+    void sendRequest(const std::string& method, const json& params);     // 응답은 무시
     void sendNotification(const std::string& method, const json& params);
     
+    json serverStats();
+    
 private:
+    std::shared_ptr<UnrealEngineAnalyzer> analyzerFor(const std::string& uri) const;
+    std::vector<std::shared_ptr<UnrealEngineAnalyzer>> allAnalyzers() const;
+    std::optional<std::string> documentText(const std::string& uri);     // 열린 문서, 닫혔으면 디스크 내용
+    void runMaintenance();
+    void publishDiagnostics(const std::string& uri);
+    void writeMessage(const std::string& payload);
     LSPMessage parseMessage(const std::string& message);
     std::string getCurrentWord(const std::string& text, int line, int character);
     std::string getContext(const std::string& text, int line, int character);
 };
 
+// =============================================================================
+// 데몬 모드 (Unix 도메인 소켓)
+// 프로세스 하나가 엔진/프로젝트 인덱스를 소유하고, 에디터 창마다 뜨는 프런트엔드는
+// stdio <-> 소켓 중계만 한다. 엔진 인덱스는 EngineIndexRegistry, 프로젝트 분석기(인덱스,
+// 교차 참조, include 그래프)는 ProjectAnalyzerRegistry로 세션 간에 공유.
+// =============================================================================
+
+struct DaemonOptions {
+    std::string socketPath;
+    size_t memoryBudgetMB = MemoryBudget::DefaultBudgetMB;
+    std::chrono::seconds idleTimeout{0};    // 세션이 하나도 없을 때 종료까지 (0 = 계속 실행)
+    // 세션이 모두 닫힌 프로젝트 분석기 / 엔진 인덱스를 유지하는 시간 (idleTimeout 이 있으면 그 값)
+    static constexpr std::chrono::seconds DefaultRetention{600};
+    
+    static std::string defaultSocketPath();
+};
+
+// 연결 직후 프런트엔드가 보내는 한 줄짜리 JSON 헤더 (이후는 일반 LSP 프레임)
+struct DaemonHandshake {
+    std::string projectPath;
+    std::string enginePath;
+    
+    std::string serialize() const;
+    static DaemonHandshake parse(const std::string& line);
+};
+
+class LSPDaemon {
+public:
+    explicit LSPDaemon(DaemonOptions options);
+    ~LSPDaemon();
+    
+    int serve();            // stop() 또는 유휴 시간 초과까지 블록
+    void stop() { stopRequested_ = true; }
+    size_t activeSessions() const { return activeSessions_.load(); }
+    
+private:
+    struct Session {
+        int fd = -1;            // 세션 스레드가 끝난 뒤 reapSessions에서 닫음
+        std::thread thread;
+        std::atomic<bool> finished{false};
+    };
+    
+    void runSession(int clientFd, Session& session);
+    void reapSessions(bool all);
+    
+    DaemonOptions options_;
+    int listenFd_ = -1;
+    int lockFd_ = -1;
+    std::atomic<bool> stopRequested_{false};
+    std::atomic<size_t> activeSessions_{0};
+    std::list<Session> sessions_;
+};
+
+// 에디터가 실행하는 얇은 프런트엔드 - 데몬이 없으면 띄운 뒤 연결
+class DaemonClient {
+public:
+    DaemonClient(std::string socketPath, std::string serverExecutable);
+    
+    int run(const DaemonHandshake& handshake, int inputFd = 0, int outputFd = 1);
+    
+private:
+    int connectOrSpawn();
+    bool spawnDaemon();
+    
+    std::string socketPath_;
+    std::string serverExecutable_;
+};
+
 } // namespace UnrealEngine
+
+namespace std {
+template <>
+struct hash<UnrealEngine::InternedString> {
+    size_t operator()(const UnrealEngine::InternedString& value) const noexcept {
+        return hash<UnrealEngine::SymbolId>()(value.id());
+    }
+};
+} // namespace std
@@ -2,6 +2,8 @@
 #include <iostream>
 #include <exception>
 #include <functional>
+#include <csignal>
+#include <charconv>
 
 using namespace UnrealEngine;
 
@@ -13,6 +15,16 @@ void printUsage(const char* programName) {
     std::cerr << "  --interactive, -i        Interactive project selection\n";
     std::cerr << "  --search-path <path>     Path to search for projects (default: current dir)\n";
     std::cerr << "  --list-engines           List all detected Unreal Engine installations\n";
+    std::cerr << "  --memory-budget-mb <n>   Memory budget for caches and indexes (default: 1024)\n";
+    std::cerr << "  --stats-interval <sec>   Periodically dump latency statistics to stderr\n";
+    std::cerr << "  --trace-file <path>      Record a Chrome trace (chrome://tracing, Perfetto) of server activity\n";
+    std::cerr << "  --lazy-index             Only record class locations at startup, parse members on first use\n";
+    std::cerr << "  --build-index <engine>   Scan an engine offline on all cores and write a prebuilt index (repeatable)\n";
+    std::cerr << "  --out <path>             Output file for --build-index, or a directory with several engines\n";
+    std::cerr << "  --daemon                 Run the shared index daemon (one engine scan for all editor windows)\n";
+    std::cerr << "  --connect                Act as a thin front-end to the daemon, starting it if needed\n";
+    std::cerr << "  --socket <path>          Daemon socket (default: $TMPDIR/unreal-lsp-<uid>.sock)\n";
+    std::cerr << "  --idle-timeout <sec>     Daemon exits after this long without sessions (default: never)\n";
     std::cerr << "  --help, -h               Show this help message\n";
     std::cerr << "  --version, -v            Show version information\n";
     std::cerr << "\nDescription:\n";
@@ -36,6 +48,15 @@ void printVersion() {
     std::cerr << "Built with C++17 and nlohmann/json\n";
 }
 
+// 양의 정수 옵션 값 - 숫자가 아니거나 0 이하면 nullopt
+template <typename T>
+std::optional<T> parsePositive(const std::string& text) {
+    T value{};
+    auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc() || end != text.data() + text.size() || value <= 0) return std::nullopt;
+    return value;
+}
+
 // 프로젝트 파일 검색 및 선택 기능
 std::string findAndSelectProject(const std::string& searchPath = "") {
     std::vector<std::string> projectFiles;
@@ -114,6 +135,13 @@ std::string findAndSelectProject(const std::string& searchPath = "") {
     return selectedProject;
 }
 
+// SIGINT/SIGTERM 시 데몬의 accept 루프를 멈춤
+LSPDaemon* g_daemon = nullptr;
+
+void stopDaemon(int) {
+    if (g_daemon) g_daemon->stop();
+}
+
 // 문자열이 특정 prefix로 시작하는지 확인하는 헬퍼 함수
 bool startsWith(const std::string& str, const std::string& prefix) {
     return str.size() >= prefix.size() && str.compare(0, prefix.size(), prefix) == 0;
@@ -130,6 +158,16 @@ int main(int argc, char* argv[]) {
     std::string searchPath;
     bool interactive = false;
     bool listEngines = false;
+    size_t memoryBudgetMB = MemoryBudget::DefaultBudgetMB;
+    int statsInterval = 0;
+    std::string traceFile;
+    bool daemonMode = false;
+    bool connectMode = false;
+    std::string socketPath;
+    int idleTimeout = 0;
+    bool lazyIndex = false;
+    std::vector<std::string> buildIndexEngines;
+    std::string buildIndexOut;
     
     // 명령줄 인자 파싱
     for (int i = 1; i < argc; ++i) {
@@ -158,6 +196,54 @@ int main(int argc, char* argv[]) {
         else if (arg == "--list-engines") {
             listEngines = true;
         }
+        else if (arg == "--memory-budget-mb" && i + 1 < argc) {
+            auto value = parsePositive<size_t>(argv[++i]);
+            if (!value) {
+                std::cerr << "❌ --memory-budget-mb expects a positive integer: " << argv[i] << std::endl;
+                printUsage(argv[0]);
+                return 1;
+            }
+            memoryBudgetMB = *value;
+        }
+        else if (arg == "--stats-interval" && i + 1 < argc) {
+            auto value = parsePositive<int>(argv[++i]);
+            if (!value) {
+                std::cerr << "❌ --stats-interval expects a positive integer: " << argv[i] << std::endl;
+                printUsage(argv[0]);
+                return 1;
+            }
+            statsInterval = *value;
+        }
+        else if (arg == "--trace-file" && i + 1 < argc) {
+            traceFile = argv[++i];
+        }
+        else if (arg == "--build-index" && i + 1 < argc) {
+            buildIndexEngines.push_back(argv[++i]);
+        }
+        else if (arg == "--out" && i + 1 < argc) {
+            buildIndexOut = argv[++i];
+        }
+        else if (arg == "--lazy-index") {
+            lazyIndex = true;
+        }
+        else if (arg == "--daemon") {
+            daemonMode = true;
+        }
+        else if (arg == "--connect") {
+            connectMode = true;
+        }
+        else if (arg == "--socket" && i + 1 < argc) {
+            socketPath = argv[++i];
+        }
+        else if (arg == "--idle-timeout" && i + 1 < argc) {
+            auto value = parsePositive<int>(argv[++i]);
+            if (!value) {
+                std::cerr << "❌ --idle-timeout expects a positive integer: " << argv[i] << std::endl;
+                printUsage(argv[0]);
+                return 1;
+            }
+            idleTimeout = *value;
+        }
         else if (startsWith(arg, "--")) {
             std::cerr << "❌ Unknown option: " << arg << std::endl;
             printUsage(argv[0]);
@@ -165,6 +251,8 @@ int main(int argc, char* argv[]) {
         }
     }
     
+    EngineIndexRegistry::instance().setLazyParsing(lazyIndex);
+    
     // 시작 메시지
     std::cerr << "🎯 Unreal Engine LSP Server for macOS & Xcode" << std::endl;
     std::cerr << "   IntelliSense Support for UE 4.20+ and UE 5.x" << std::endl;
@@ -204,6 +292,75 @@ int main(int argc, char* argv[]) {
             return 0;
         }
         
+        // 오프라인 인덱스 빌드: 빌드 머신에서 엔진 버전마다 한 번
+        // 여러 버전을 한 번에 빌드하면 내용이 같은 헤더는 한 번만 파싱 (ParsedHeaderCache)
+        if (!buildIndexEngines.empty()) {
+            bool outputIsDirectory = buildIndexEngines.size() > 1;
+            if (outputIsDirectory) {
+                ParsedHeaderCache::instance().setCapacity(memoryBudgetMB * 1024 * 1024);
+                if (!buildIndexOut.empty()) {
+                    std::filesystem::create_directories(buildIndexOut);
+                }
+            }
+            
+            size_t workers = std::max(1u, std::thread::hardware_concurrency());
+            UnrealEngineDetector detector;
+            for (const auto& enginePathToIndex : buildIndexEngines) {
+                EngineVersion version = detector.detectEngineVersion(enginePathToIndex);
+                if (version.major == 0) {
+                    std::cerr << "❌ Not an Unreal Engine installation: " << enginePathToIndex << std::endl;
+                    return 1;
+                }
+                
+                std::string outputPath = PrebuiltEngineIndex::fileNameFor(version);
+                if (outputIsDirectory && !buildIndexOut.empty()) {
+                    outputPath = buildIndexOut + "/" + outputPath;
+                } else if (!buildIndexOut.empty()) {
+                    outputPath = buildIndexOut;
+                }
+                
+                std::cerr << "🔨 Indexing UE " << version.toString() << " at " << version.installPath
+                          << " with " << workers << " threads..." << std::endl;
+                
+                auto start = std::chrono::steady_clock::now();
+                DynamicHeaderScanner scanner(version);
+                scanner.scanEngineHeaders(workers);
+                double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                
+                if (!PrebuiltEngineIndex::write(scanner, version, outputPath)) {
+                    std::cerr << "❌ Failed to write " << outputPath << std::endl;
+                    return 1;
+                }
+                std::cerr << "✅ Wrote " << scanner.records().size() << " symbols to " << outputPath
+                          << " (" << seconds << "s)" << std::endl;
+            }
+            
+            auto scanStats = ServerMetrics::instance().snapshot()["scan"];
+            if (outputIsDirectory) {
+                std::cerr << "♻️  " << scanStats["headersDeduplicated"] << " of " << scanStats["files"]
+                          << " headers were identical to an already parsed version" << std::endl;
+            }
+            std::cerr << "   Copy the index to <engine>/Engine/Intermediate/UnrealLSP/ or $UNREAL_LSP_INDEX_DIR on each workstation" << std::endl;
+            return 0;
+        }
+        
+        // 데몬: 프로젝트는 세션마다 핸드셰이크로 받음
+        if (daemonMode) {
+            if (!traceFile.empty()) {
+                TraceRecorder::instance().start(traceFile);
+            }
+            
+            LSPDaemon daemon(DaemonOptions{socketPath, memoryBudgetMB, std::chrono::seconds(idleTimeout)});
+            g_daemon = &daemon;
+            std::signal(SIGINT, stopDaemon);
+            std::signal(SIGTERM, stopDaemon);
+            
+            int result = daemon.serve();
+            g_daemon = nullptr;
+            TraceRecorder::instance().flush();
+            return result;
+        }
+        
         // 프로젝트 선택 로직
         if (interactive || projectPath.empty()) {
             if (interactive) {
@@ -320,10 +477,26 @@ int main(int argc, char* argv[]) {
             std::cerr << "   Using default engine version (UE 5.3)" << std::endl;
         }
         
+        // 프런트엔드: 인덱스는 데몬이 소유, 여기서는 stdio만 중계
+        if (connectMode) {
+            std::cerr << "🔌 Connecting to shared index daemon..." << std::endl;
+            DaemonClient client(socketPath, argv[0]);
+            return client.run(DaemonHandshake{projectPath, enginePath});
+        }
+        
+        if (!traceFile.empty()) {
+            TraceRecorder::instance().start(traceFile);
+            std::cerr << "🧭 Recording trace to: " << traceFile << std::endl;
+        }
+        
         // LSP 서버 초기화
         std::cerr << "🚀 Initializing LSP server..." << std::endl;
         LSPServer server;
+        server.setMemoryBudget(memoryBudgetMB);
         server.initialize(projectPath, enginePath);
+        if (statsInterval > 0) {
+            server.enablePeriodicStats(std::chrono::seconds(statsInterval));
+        }
         
         std::cerr << "✅ LSP Server ready for project: " << projectName << std::endl;
         std::cerr << "📡 Listening for LSP messages on stdin..." << std::endl;
@@ -332,6 +505,10 @@ int main(int argc, char* argv[]) {
         // LSP 통신 시작
         server.run();
         
+        if (TraceRecorder::instance().flush()) {
+            std::cerr << "🧭 Trace written to: " << traceFile << std::endl;
+        }
+        
     } catch (const std::exception& e) {
         std::cerr << "❌ Fatal Error: " << e.what() << std::endl;
         std::cerr << "   Please check your project path and try again" << std::endl;